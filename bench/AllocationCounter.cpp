@@ -0,0 +1,53 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> allocations = 0U;
+
+} // namespace
+
+void* operator new(size_t size) {
+    allocations.fetch_add(1U, std::memory_order_relaxed);
+    if (void* data = std::malloc(size ? size : 1U)) {
+        return data;
+    }
+    throw std::bad_alloc();
+}
+
+// the replaced operator new allocates by malloc
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* data) noexcept {
+    std::free(data);
+}
+
+void operator delete(void* data, size_t) noexcept {
+    std::free(data);
+}
+
+namespace Websocket
+{
+
+uint64_t allocationCount() noexcept {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace Websocket
@@ -0,0 +1,25 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AllocationCounter.h
+#include <cstdint>
+
+namespace Websocket
+{
+
+// number of heap allocations of the process by global `operator new` since its start,
+// counted by the replacement of the operator defined in AllocationCounter.cpp,
+// which is linked into executables using this function
+uint64_t allocationCount() noexcept;
+
+} // namespace Websocket
@@ -0,0 +1,118 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "EchoServer.h"
+#include "LoopbackClient.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using namespace Websocket;
+
+// client connected to the bundled echo server over loopback TCP
+class EchoConnection
+{
+public:
+    EchoConnection() {
+        auto listener = listenTcp();
+        const auto port = localPort(listener);
+        _ok = _server.start(std::move(listener)) && _client.connect(connectTcp(port));
+    }
+    ~EchoConnection() { _client.close(); }
+    bool ok() const noexcept { return _ok; }
+    LoopbackClient& client() noexcept { return _client; }
+
+private:
+    EchoServer _server;
+    LoopbackClient _client;
+    bool _ok = false;
+};
+
+bool receiveEchoes(benchmark::State& state, LoopbackClient& client, size_t count) {
+    LoopbackClient::Message echo;
+    for (size_t i = 0U; i < count; ++i) {
+        if (!client.receive(echo)) {
+            state.SkipWithError("echo is not received");
+            return false;
+        }
+    }
+    return true;
+}
+
+void report(benchmark::State& state) {
+    const auto messages = state.iterations() * state.range(0);
+    state.SetItemsProcessed(messages);
+    state.SetBytesProcessed(messages * state.range(1));
+}
+
+// the baseline: [range(0)] messages of [range(1)] bytes, a write per message
+void sequential(benchmark::State& state) {
+    EchoConnection connection;
+    if (!connection.ok()) {
+        state.SkipWithError("echo server is not reachable");
+        return;
+    }
+    auto& client = connection.client();
+    const auto count = static_cast<size_t>(state.range(0));
+    const std::vector<uint8_t> payload(static_cast<size_t>(state.range(1)), 0x5AU);
+    for (auto _ : state) {
+        for (size_t i = 0U; i < count; ++i) {
+            if (!client.send(Opcode::Binary, payload.data(), payload.size())) {
+                state.SkipWithError("send failed");
+                return;
+            }
+        }
+        if (!receiveEchoes(state, client, count)) {
+            return;
+        }
+    }
+    report(state);
+}
+
+// the same messages by `LoopbackClient::sendBatch`, a single vectored write per batch;
+// payloads are masked in place, so they are refilled each iteration, which matches
+// the copy into the output buffer made by `send`
+void batched(benchmark::State& state) {
+    EchoConnection connection;
+    if (!connection.ok()) {
+        state.SkipWithError("echo server is not reachable");
+        return;
+    }
+    auto& client = connection.client();
+    const auto count = static_cast<size_t>(state.range(0));
+    const std::vector<uint8_t> payload(static_cast<size_t>(state.range(1)), 0x5AU);
+    std::vector<LoopbackClient::Message> batch(count);
+    for (auto& message : batch) {
+        message._payload.resize(payload.size());
+    }
+    for (auto _ : state) {
+        for (auto& message : batch) {
+            std::memcpy(message._payload.data(), payload.data(), payload.size());
+        }
+        if (!client.sendBatch(batch.data(), batch.size())) {
+            state.SkipWithError("send failed");
+            return;
+        }
+        if (!receiveEchoes(state, client, count)) {
+            return;
+        }
+    }
+    report(state);
+}
+
+} // namespace
+
+BENCHMARK(sequential)->ArgsProduct({{1, 8, 64}, {64, 1024}})->UseRealTime();
+BENCHMARK(batched)->ArgsProduct({{1, 8, 64}, {64, 1024}})->UseRealTime();
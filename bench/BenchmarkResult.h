@@ -0,0 +1,134 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // BenchmarkResult.h
+#include "WebsocketScheme.h"
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Websocket
+{
+
+// loopback benchmark scenarios of `Factory` implementations, all of them run endpoints
+// of the factory against a local echo server, each scenario may be repeated for several
+// transports (see `BenchmarkResult::_transport`), e.g. loopback TCP and Unix domain sockets
+enum class BenchmarkScenario
+{
+    // rate of opening connections, including TCP/TLS handshakes and HTTP upgrade
+    ConnectRate,
+    // throughput of small messages, `LoopbackConfig::_smallMessageSize` (64 bytes)
+    SmallMessageThroughput,
+    // throughput of large messages, `LoopbackConfig::_largeMessageSize` (1 MiB)
+    LargeMessageThroughput,
+    // round-trip time of ping/pong exchanges on an idle connection
+    PingRtt,
+    // echo latency of messages under sustained load
+    LatencyUnderLoad,
+    // recovery of many endpoints with `ReconnectPolicy` after the server restart,
+    // `_elapsed` is the time until all of them are connected again; reported only by the
+    // discrete-event model of `websocket_reconnect_storm` (simulated time, no transport)
+    ReconnectStorm
+};
+
+// stable identifier of the scenario in reports
+inline const char* toString(BenchmarkScenario scenario) {
+    switch (scenario) {
+        case BenchmarkScenario::ConnectRate:
+            return "connect_rate";
+        case BenchmarkScenario::SmallMessageThroughput:
+            return "small_message_throughput";
+        case BenchmarkScenario::LargeMessageThroughput:
+            return "large_message_throughput";
+        case BenchmarkScenario::PingRtt:
+            return "ping_rtt";
+        case BenchmarkScenario::LatencyUnderLoad:
+            return "latency_under_load";
+        case BenchmarkScenario::ReconnectStorm:
+            return "reconnect_storm";
+        default:
+            break;
+    }
+    return "unknown";
+}
+
+// result of a single benchmark scenario
+struct BenchmarkResult
+{
+    BenchmarkScenario _scenario = BenchmarkScenario::ConnectRate;
+    // e.g. loopback TCP (`Scheme::Ws`) or `Scheme::Unix`
+    Scheme _transport = Scheme::Ws;
+    // completed operations: connections, messages or pings
+    uint64_t _operations = 0U;
+    // transferred payload bytes
+    uint64_t _bytes = 0U;
+    // heap allocations of the whole process during the measurement, see `allocationCount`
+    uint64_t _allocations = 0U;
+    // wall-clock duration of the measurement
+    std::chrono::nanoseconds _elapsed = {};
+    // latency percentiles of operations
+    std::chrono::nanoseconds _latencyP50 = {};
+    std::chrono::nanoseconds _latencyP99 = {};
+    std::chrono::nanoseconds _latencyP999 = {};
+
+    double operationsPerSecond() const noexcept {
+        return _elapsed.count() > 0 ? static_cast<double>(_operations) * 1e9 / static_cast<double>(_elapsed.count()) : 0.;
+    }
+    double bytesPerSecond() const noexcept {
+        return _elapsed.count() > 0 ? static_cast<double>(_bytes) * 1e9 / static_cast<double>(_elapsed.count()) : 0.;
+    }
+};
+
+// formats results as a JSON document for regression gating, latencies are in nanoseconds,
+// numbers are written in the classic locale, rates with full double precision
+inline std::string toJson(std::string_view implementation, const std::vector<BenchmarkResult>& results) {
+    std::ostringstream os;
+    os.imbue(std::locale::classic());
+    os.precision(std::numeric_limits<double>::max_digits10);
+    os << "{\"implementation\":\"";
+    for (const char c : implementation) {
+        if ('"' == c || '\\' == c) {
+            os << '\\';
+        }
+        if (static_cast<unsigned char>(c) >= 0x20U) {
+            os << c;
+        }
+    }
+    os << "\",\"results\":[";
+    for (size_t i = 0U; i < results.size(); ++i) {
+        const auto& result = results[i];
+        if (i) {
+            os << ',';
+        }
+        os << "{\"scenario\":\"" << toString(result._scenario) << '"'
+           << ",\"transport\":\"" << toString(result._transport) << '"'
+           << ",\"operations\":" << result._operations
+           << ",\"bytes\":" << result._bytes
+           << ",\"allocations\":" << result._allocations
+           << ",\"elapsed_ns\":" << result._elapsed.count()
+           << ",\"operations_per_second\":" << result.operationsPerSecond()
+           << ",\"bytes_per_second\":" << result.bytesPerSecond()
+           << ",\"latency_p50_ns\":" << result._latencyP50.count()
+           << ",\"latency_p99_ns\":" << result._latencyP99.count()
+           << ",\"latency_p999_ns\":" << result._latencyP999.count() << '}';
+    }
+    os << "]}";
+    return os.str();
+}
+
+} // namespace Websocket
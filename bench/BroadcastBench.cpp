@@ -0,0 +1,110 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketPreparedMessage.h"
+#include "BytesBlob.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace Websocket;
+
+// server endpoint queuing outgoing frames the way a transport does before writing them:
+// `sendBinary` frames & copies the payload, `sendPrepared` references the shared frame
+class QueuingEndPoint : public EndPoint
+{
+public:
+    struct Outgoing
+    {
+        std::vector<uint8_t> _frame;
+        std::shared_ptr<const PreparedMessage> _prepared;
+    };
+    void drain() { _queue.clear(); }
+    // impl. of EndPoint
+    void setListener(const std::shared_ptr<Listener>&) final {}
+    bool open(Options, uint64_t) final { return true; }
+    void close() final {}
+    std::string host() const final { return {}; }
+    State state() const final { return State::Connected; }
+    bool sendBinary(const Bricks::Blob& binary) final {
+        Outgoing outgoing;
+        outgoing._frame.resize(FrameCodec::headerSize(binary.size(), false) + binary.size());
+        const auto headerSize = FrameCodec::writeHeader(outgoing._frame.data(), Opcode::Binary,
+                                                        true, binary.size(), nullptr);
+        std::memcpy(outgoing._frame.data() + headerSize, binary.data(), binary.size());
+        _queue.push_back(std::move(outgoing));
+        return true;
+    }
+    bool sendText(std::string_view) final { return false; }
+    bool sendPrepared(const std::shared_ptr<const PreparedMessage>& message) final {
+        _queue.push_back({{}, message});
+        return true;
+    }
+    bool ping(const Bricks::Blob&) final { return false; }
+    bool ping() final { return false; }
+
+private:
+    std::vector<Outgoing> _queue;
+};
+
+// [range(0)] endpoints, [range(1)] bytes of payload
+std::vector<std::unique_ptr<QueuingEndPoint>> makeEndpoints(const benchmark::State& state) {
+    std::vector<std::unique_ptr<QueuingEndPoint>> endpoints(static_cast<size_t>(state.range(0)));
+    for (auto& endPoint : endpoints) {
+        endPoint = std::make_unique<QueuingEndPoint>();
+    }
+    return endpoints;
+}
+
+void report(benchmark::State& state) {
+    const auto sends = state.iterations() * state.range(0);
+    state.SetItemsProcessed(sends);
+    state.SetBytesProcessed(sends * state.range(1));
+}
+
+// the baseline: a separate `sendBinary` per endpoint
+void perEndpoint(benchmark::State& state) {
+    auto endpoints = makeEndpoints(state);
+    const BytesBlob payload(std::vector<uint8_t>(static_cast<size_t>(state.range(1)), 0x5AU));
+    for (auto _ : state) {
+        for (const auto& endPoint : endpoints) {
+            endPoint->sendBinary(payload);
+        }
+        for (const auto& endPoint : endpoints) {
+            endPoint->drain();
+        }
+    }
+    report(state);
+}
+
+// the message is framed once per broadcast & shared by all endpoints
+void prepared(benchmark::State& state) {
+    auto endpoints = makeEndpoints(state);
+    const std::vector<uint8_t> payload(static_cast<size_t>(state.range(1)), 0x5AU);
+    for (auto _ : state) {
+        const auto message = PreparedMessage::binary(payload.data(), payload.size());
+        broadcast(endpoints.begin(), endpoints.end(), message);
+        for (const auto& endPoint : endpoints) {
+            endPoint->drain();
+        }
+    }
+    report(state);
+}
+
+} // namespace
+
+BENCHMARK(perEndpoint)->ArgsProduct({{100, 1000, 10000}, {64, 4096}})->Args({1000, 65536});
+BENCHMARK(prepared)->ArgsProduct({{100, 1000, 10000}, {64, 4096}})->Args({1000, 65536});
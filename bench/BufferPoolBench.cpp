@@ -0,0 +1,94 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketBufferPool.h"
+#include "AllocationCounter.h"
+#include <benchmark/benchmark.h>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace Websocket;
+
+constexpr size_t framesPerBatch = 64U;
+
+// the baseline: a heap allocation per frame
+struct HeapAllocator
+{
+    BufferPool::Buffer acquire(size_t size) { return {static_cast<uint8_t*>(::operator new(size)), size}; }
+    void release(BufferPool::Buffer buffer) noexcept { ::operator delete(buffer._data); }
+};
+
+template <class Allocator>
+void touch(Allocator& allocator, std::vector<BufferPool::Buffer>& buffers, size_t size) {
+    for (size_t i = 0U; i < framesPerBatch; ++i) {
+        buffers.push_back(allocator.acquire(size));
+        buffers.back()._data[0] = uint8_t(i);
+    }
+}
+
+// heap allocations of the whole process are reported per frame
+void report(benchmark::State& state, uint64_t allocationsBefore) {
+    const auto frames = static_cast<double>(state.iterations() * framesPerBatch);
+    state.counters["allocs_per_frame"] = static_cast<double>(allocationCount() - allocationsBefore) / frames;
+    state.SetItemsProcessed(static_cast<int64_t>(frames));
+}
+
+// acquire & release of [range(0)] bytes on the same thread
+template <class Allocator>
+void sameThread(benchmark::State& state) {
+    Allocator allocator;
+    std::vector<BufferPool::Buffer> buffers;
+    buffers.reserve(framesPerBatch);
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto before = allocationCount();
+    for (auto _ : state) {
+        touch(allocator, buffers, size);
+        for (const auto& buffer : buffers) {
+            allocator.release(buffer);
+        }
+        buffers.clear();
+    }
+    report(state, before);
+}
+
+// a reader thread acquires frames, a worker thread releases them
+template <class Allocator>
+void crossThread(benchmark::State& state) {
+    Allocator allocator;
+    std::vector<BufferPool::Buffer> buffers;
+    buffers.reserve(framesPerBatch);
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto before = allocationCount();
+    for (auto _ : state) {
+        touch(allocator, buffers, size);
+        std::thread worker([&]() {
+            for (const auto& buffer : buffers) {
+                allocator.release(buffer);
+            }
+        });
+        worker.join();
+        buffers.clear();
+    }
+    // includes one allocation per batch by creation of the worker thread
+    report(state, before);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(sameThread, HeapAllocator)->Arg(512)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(sameThread, BufferPool)->Arg(512)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(crossThread, HeapAllocator)->Arg(512)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(crossThread, BufferPool)->Arg(512)->Arg(64 << 10);
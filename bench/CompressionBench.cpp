@@ -0,0 +1,234 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "EchoServer.h"
+#include "LoopbackClient.h"
+#include "WebsocketCompression.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+// Throughput and CPU cost of permessage-deflate settings (`Compression`) on a loopback echo.
+// The bundled echo server doesn't negotiate the extension, so messages compressed by RFC 7692
+// rules travel as plain binary frames of the compressed size and the client inflates echoes
+// itself: the CPU time of the benchmark thread covers deflate & inflate of every message,
+// the wire size is reported by `wire_ratio` (compressed / original bytes).
+
+namespace {
+
+using namespace Websocket;
+
+constexpr size_t messagesPerRound = 16U;
+constexpr size_t messageSize = 4096U;
+// tail of the deflate stream after Z_SYNC_FLUSH, stripped from messages by RFC 7692
+constexpr uint8_t syncTail[4] = {0x00U, 0x00U, 0xFFU, 0xFFU};
+
+// raw deflate of zlib doesn't support 256-byte windows, 9 bits is the nearest
+int zlibWindowBits(uint8_t bits) {
+    return -std::max(9, static_cast<int>(clampWindowBits(bits)));
+}
+
+// client side of the extension with settings of `Compression` for outgoing messages
+class Deflater
+{
+public:
+    explicit Deflater(const Compression& compression)
+        : _noContextTakeover(compression._clientNoContextTakeover)
+    {
+        _ok = Z_OK == deflateInit2(&_stream, compression._level, Z_DEFLATED,
+                                   zlibWindowBits(compression._clientMaxWindowBits), 8, Z_DEFAULT_STRATEGY);
+    }
+    ~Deflater() { deflateEnd(&_stream); }
+    bool compress(const std::vector<uint8_t>& input, std::vector<uint8_t>& output);
+
+private:
+    z_stream _stream = {};
+    const bool _noContextTakeover;
+    bool _ok = false;
+};
+
+class Inflater
+{
+public:
+    Inflater(uint8_t windowBits, bool noContextTakeover)
+        : _noContextTakeover(noContextTakeover)
+    {
+        _ok = Z_OK == inflateInit2(&_stream, zlibWindowBits(windowBits));
+    }
+    ~Inflater() { inflateEnd(&_stream); }
+    bool decompress(std::vector<uint8_t>& input, std::vector<uint8_t>& output);
+
+private:
+    z_stream _stream = {};
+    const bool _noContextTakeover;
+    bool _ok = false;
+};
+
+bool Deflater::compress(const std::vector<uint8_t>& input, std::vector<uint8_t>& output) {
+    if (!_ok) {
+        return false;
+    }
+    output.resize(deflateBound(&_stream, static_cast<uLong>(input.size())) + sizeof(syncTail));
+    _stream.next_in = const_cast<Bytef*>(input.data());
+    _stream.avail_in = static_cast<uInt>(input.size());
+    _stream.next_out = output.data();
+    _stream.avail_out = static_cast<uInt>(output.size());
+    if (Z_OK != deflate(&_stream, Z_SYNC_FLUSH) || 0U != _stream.avail_in) {
+        return false;
+    }
+    output.resize(output.size() - _stream.avail_out - sizeof(syncTail));
+    return !_noContextTakeover || Z_OK == deflateReset(&_stream);
+}
+
+bool Inflater::decompress(std::vector<uint8_t>& input, std::vector<uint8_t>& output) {
+    if (!_ok) {
+        return false;
+    }
+    input.insert(input.end(), std::begin(syncTail), std::end(syncTail));
+    output.resize(messageSize);
+    _stream.next_in = input.data();
+    _stream.avail_in = static_cast<uInt>(input.size());
+    _stream.next_out = output.data();
+    _stream.avail_out = static_cast<uInt>(output.size());
+    const auto status = inflate(&_stream, Z_SYNC_FLUSH);
+    if ((Z_OK != status && Z_BUF_ERROR != status) || 0U != _stream.avail_in) {
+        return false;
+    }
+    output.resize(output.size() - _stream.avail_out);
+    return !_noContextTakeover || Z_OK == inflateReset(&_stream);
+}
+
+// JSON-like messages of a market data feed: repetitive keys, varying numbers
+std::vector<std::vector<uint8_t>> makeMessages() {
+    std::vector<std::vector<uint8_t>> messages(messagesPerRound);
+    uint64_t random = 0x9E3779B97F4A7C15ULL;
+    for (auto& message : messages) {
+        std::string text = "[";
+        while (text.size() < messageSize) {
+            random ^= random << 13;
+            random ^= random >> 7;
+            random ^= random << 17;
+            text += "{\"symbol\":\"SYM" + std::to_string(random % 64U) + "\",\"price\":" +
+                    std::to_string(random % 100000U) + ",\"size\":" + std::to_string((random >> 20U) % 1000U) + "},";
+        }
+        text.resize(messageSize - 1U);
+        text += ']';
+        message.assign(text.begin(), text.end());
+    }
+    return messages;
+}
+
+// client connected to the bundled echo server over loopback TCP
+class EchoConnection
+{
+public:
+    EchoConnection() {
+        auto listener = listenTcp();
+        const auto port = localPort(listener);
+        _ok = _server.start(std::move(listener)) && _client.connect(connectTcp(port));
+    }
+    ~EchoConnection() { _client.close(); }
+    bool ok() const noexcept { return _ok; }
+    LoopbackClient& client() noexcept { return _client; }
+
+private:
+    EchoServer _server;
+    LoopbackClient _client;
+    bool _ok = false;
+};
+
+// the baseline: uncompressed echo of the same messages
+void uncompressed(benchmark::State& state) {
+    EchoConnection connection;
+    if (!connection.ok()) {
+        state.SkipWithError("echo server is not reachable");
+        return;
+    }
+    auto& client = connection.client();
+    const auto messages = makeMessages();
+    LoopbackClient::Message echo;
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            client.queue(Opcode::Binary, message.data(), message.size());
+        }
+        if (!client.flush()) {
+            state.SkipWithError("send failed");
+            return;
+        }
+        for (size_t i = 0U; i < messages.size(); ++i) {
+            if (!client.receive(echo)) {
+                state.SkipWithError("echo failed");
+                return;
+            }
+        }
+    }
+    const auto sent = state.iterations() * static_cast<int64_t>(messagesPerRound);
+    state.SetItemsProcessed(sent);
+    state.SetBytesProcessed(sent * static_cast<int64_t>(messageSize));
+    state.counters["wire_ratio"] = 1.;
+}
+
+// [range(0)] deflate level, [range(1)] window bits, [range(2)] no context takeover
+void deflated(benchmark::State& state) {
+    EchoConnection connection;
+    if (!connection.ok()) {
+        state.SkipWithError("echo server is not reachable");
+        return;
+    }
+    Compression compression;
+    compression._level = static_cast<uint8_t>(state.range(0));
+    compression._clientMaxWindowBits = static_cast<uint8_t>(state.range(1));
+    compression._clientNoContextTakeover = 0 != state.range(2);
+    Deflater deflater(compression);
+    Inflater inflater(compression._clientMaxWindowBits, compression._clientNoContextTakeover);
+    auto& client = connection.client();
+    const auto messages = makeMessages();
+    std::vector<uint8_t> compressed, inflated;
+    LoopbackClient::Message echo;
+    uint64_t wireBytes = 0U;
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            if (!deflater.compress(message, compressed)) {
+                state.SkipWithError("deflate failed");
+                return;
+            }
+            wireBytes += compressed.size();
+            client.queue(Opcode::Binary, compressed.data(), compressed.size());
+        }
+        if (!client.flush()) {
+            state.SkipWithError("send failed");
+            return;
+        }
+        for (size_t i = 0U; i < messages.size(); ++i) {
+            if (!client.receive(echo) || !inflater.decompress(echo._payload, inflated) ||
+                inflated.size() != messageSize) {
+                state.SkipWithError("echo failed");
+                return;
+            }
+        }
+    }
+    const auto sent = state.iterations() * static_cast<int64_t>(messagesPerRound);
+    state.SetItemsProcessed(sent);
+    state.SetBytesProcessed(sent * static_cast<int64_t>(messageSize));
+    if (sent > 0) {
+        state.counters["wire_ratio"] = static_cast<double>(wireBytes) / static_cast<double>(sent * static_cast<int64_t>(messageSize));
+    }
+}
+
+} // namespace
+
+BENCHMARK(uncompressed);
+BENCHMARK(deflated)->ArgNames({"level", "window_bits", "no_context_takeover"})
+                   ->ArgsProduct({{1, 6, 9}, {Compression::MinWindowBits, Compression::MaxWindowBits}, {0, 1}});
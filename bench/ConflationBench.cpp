@@ -0,0 +1,93 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketConflatingQueue.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+
+// Tail staleness of price ticks under a throttled consumer: each round the producer queues
+// a tick of every instrument (conflation key), while the consumer writes only a part of
+// the produced messages. Staleness of a written tick is the number of rounds since it was
+// produced, so it doesn't depend on the speed of the machine; conflation keeps written ticks
+// fresh, so the gap between consecutive writes of the same instrument is reported too.
+// The time of the benchmark is the CPU cost of the queue.
+
+namespace {
+
+using namespace Websocket;
+
+constexpr uint64_t instruments = 64U;
+constexpr uint64_t rounds = 1000U;
+
+struct Tick
+{
+    uint64_t _instrument = 0U;
+    uint64_t _round = 0U;
+};
+
+double percentile(std::vector<uint64_t>& samples, double fraction) {
+    if (samples.empty()) {
+        return 0.;
+    }
+    const auto rank = static_cast<size_t>(fraction * static_cast<double>(samples.size() - 1U) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(rank), samples.end());
+    return static_cast<double>(samples[rank]);
+}
+
+// [range(0)] `SendQueue` mode, [range(1)] percentage of produced messages the consumer writes
+void staleness(benchmark::State& state) {
+    const auto mode = static_cast<SendQueue>(state.range(0));
+    const auto writesPerRound = static_cast<uint64_t>(state.range(1)) * instruments / 100U;
+    std::vector<uint64_t> staleness, gaps;
+    staleness.reserve(rounds * writesPerRound);
+    gaps.reserve(rounds * writesPerRound);
+    size_t depth = 0U;
+    uint64_t conflated = 0U;
+    for (auto _ : state) {
+        staleness.clear();
+        gaps.clear();
+        std::vector<uint64_t> lastWrites(instruments, 0U);
+        ConflatingQueue<Tick> queue(mode);
+        Tick tick;
+        SendOptions options;
+        for (uint64_t round = 0U; round < rounds; ++round) {
+            for (uint64_t instrument = 0U; instrument < instruments; ++instrument) {
+                options._conflationKey = instrument;
+                queue.push({instrument, round}, options);
+            }
+            for (uint64_t i = 0U; i < writesPerRound && queue.pop(tick); ++i) {
+                staleness.push_back(round - tick._round);
+                gaps.push_back(round - lastWrites[tick._instrument]);
+                lastWrites[tick._instrument] = round;
+            }
+        }
+        depth = queue.size();
+        conflated = queue.conflated();
+        benchmark::DoNotOptimize(tick);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rounds * instruments));
+    state.counters["staleness_p50_rounds"] = percentile(staleness, 0.5);
+    state.counters["staleness_p99_rounds"] = percentile(staleness, 0.99);
+    state.counters["staleness_max_rounds"] = percentile(staleness, 1.);
+    state.counters["update_gap_p50_rounds"] = percentile(gaps, 0.5);
+    state.counters["update_gap_p99_rounds"] = percentile(gaps, 0.99);
+    state.counters["queue_depth"] = static_cast<double>(depth);
+    state.counters["conflated"] = static_cast<double>(conflated);
+}
+
+} // namespace
+
+BENCHMARK(staleness)->ArgNames({"conflating", "consumer_percent"})
+                    ->ArgsProduct({{static_cast<int64_t>(SendQueue::Fifo), static_cast<int64_t>(SendQueue::Conflating)},
+                                   {100, 50, 10}});
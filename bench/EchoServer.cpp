@@ -0,0 +1,208 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "EchoServer.h"
+#include "WebsocketFrameDecoder.h"
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+namespace {
+
+using namespace Websocket;
+
+class EchoSession : public FrameListener
+{
+public:
+    std::vector<uint8_t>& output() noexcept { return _output; }
+    bool done() const noexcept { return _done; }
+    // impl. of FrameListener
+    void onMessageFragment(Opcode opcode, bool compressed, const uint8_t* data, size_t size,
+                           bool first, bool last) final;
+    void onPing(const uint8_t* payload, size_t size) final;
+    void onClose(uint16_t code, std::string_view reason) final;
+    void onProtocolError(uint16_t closeCode, std::string_view details) final;
+
+private:
+    void sendClose(uint16_t code, std::string_view reason);
+
+private:
+    std::vector<uint8_t> _output;
+    std::vector<uint8_t> _message;
+    Opcode _opcode = Opcode::Binary;
+    bool _done = false;
+};
+
+void EchoSession::onMessageFragment(Opcode opcode, bool /*compressed*/, const uint8_t* data, size_t size,
+                                    bool first, bool last) {
+    if (first) {
+        _opcode = opcode;
+        _message.clear();
+    }
+    if (first && last) {
+        appendFrame(_output, _opcode, data, size);
+    }
+    else {
+        _message.insert(_message.end(), data, data + size);
+        if (last) {
+            appendFrame(_output, _opcode, _message.data(), _message.size());
+        }
+    }
+}
+
+void EchoSession::onPing(const uint8_t* payload, size_t size) {
+    appendFrame(_output, Opcode::Pong, payload, size);
+}
+
+void EchoSession::onClose(uint16_t code, std::string_view reason) {
+    if (CloseCode::NoStatus == code) {
+        appendFrame(_output, Opcode::Close, nullptr, 0U);
+        _done = true;
+    }
+    else {
+        sendClose(code, reason);
+    }
+}
+
+void EchoSession::onProtocolError(uint16_t closeCode, std::string_view details) {
+    sendClose(closeCode, details.substr(0U, FrameCodec::MaxControlPayloadSize - 2U));
+}
+
+void EchoSession::sendClose(uint16_t code, std::string_view reason) {
+    uint8_t payload[FrameCodec::MaxControlPayloadSize];
+    payload[0] = static_cast<uint8_t>(code >> 8);
+    payload[1] = static_cast<uint8_t>(code);
+    std::memcpy(payload + 2, reason.data(), reason.size());
+    appendFrame(_output, Opcode::Close, payload, reason.size() + 2U);
+    _done = true;
+}
+
+} // namespace
+
+namespace Websocket
+{
+
+bool EchoServer::start(Socket listener) {
+    if (listener.valid() && !_listener.valid()) {
+        _listener = std::move(listener);
+        _stopped = false;
+        _acceptThread = std::thread(&EchoServer::acceptLoop, this);
+        return true;
+    }
+    return false;
+}
+
+void EchoServer::stop() {
+    if (_acceptThread.joinable()) {
+        _stopped = true;
+        _listener.shutdown();
+        _acceptThread.join();
+        _listener.close();
+        std::list<Connection> active;
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            active.swap(_active);
+            for (auto& connection : active) {
+                connection._socket.shutdown();
+            }
+        }
+        for (auto& connection : active) {
+            connection._thread.join();
+        }
+    }
+}
+
+void EchoServer::acceptLoop() {
+    while (!_stopped) {
+        Socket socket(::accept4(_listener.fd(), nullptr, nullptr, SOCK_CLOEXEC));
+        if (!socket.valid()) {
+            if (_stopped) {
+                break;
+            }
+            continue;
+        }
+        ++_connections;
+        const int yes = 1; // fails harmlessly for non-TCP sockets
+        ::setsockopt(socket.fd(), IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        const std::lock_guard<std::mutex> lock(_mutex);
+        // reap connections closed by peers
+        for (auto it = _active.begin(); it != _active.end();) {
+            if (!it->_socket.valid()) {
+                it->_thread.join();
+                it = _active.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        auto& connection = _active.emplace_back();
+        connection._socket = std::move(socket);
+        connection._thread = std::thread([this, &connection]() {
+            serve(connection._socket);
+            const std::lock_guard<std::mutex> lock(_mutex);
+            connection._socket.close();
+        });
+    }
+}
+
+void EchoServer::serve(Socket& socket) {
+    std::vector<uint8_t> buffer(1U << 16U);
+    std::string request;
+    size_t headerEnd = std::string::npos;
+    while (std::string::npos == headerEnd) {
+        const auto received = socket.receive(buffer.data(), buffer.size());
+        if (received <= 0 || request.size() > 16384U) {
+            return;
+        }
+        request.append(reinterpret_cast<const char*>(buffer.data()), static_cast<size_t>(received));
+        headerEnd = request.find("\r\n\r\n");
+    }
+    const auto key = headerValue(std::string_view(request).substr(0U, headerEnd + 2U), "Sec-WebSocket-Key");
+    if (key.empty()) {
+        static const std::string_view badRequest = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n";
+        socket.sendAll(badRequest.data(), badRequest.size());
+        return;
+    }
+    const std::string response = "HTTP/1.1 101 Switching Protocols\r\n"
+                                 "Upgrade: websocket\r\n"
+                                 "Connection: Upgrade\r\n"
+                                 "Sec-WebSocket-Accept: " + acceptKey(key) + "\r\n\r\n";
+    if (!socket.sendAll(response.data(), response.size())) {
+        return;
+    }
+    EchoSession session;
+    FrameDecoder decoder(session, true);
+    // frames pipelined with the upgrade request
+    std::vector<uint8_t> pending(request.begin() + static_cast<std::ptrdiff_t>(headerEnd + 4U), request.end());
+    decoder.decode(pending.data(), pending.size());
+    for (;;) {
+        auto& output = session.output();
+        if (!output.empty()) {
+            if (!socket.sendAll(output.data(), output.size())) {
+                return;
+            }
+            output.clear();
+        }
+        if (session.done()) {
+            break;
+        }
+        const auto received = socket.receive(buffer.data(), buffer.size());
+        if (received <= 0) {
+            return;
+        }
+        decoder.decode(buffer.data(), static_cast<size_t>(received));
+    }
+    ::shutdown(socket.fd(), SHUT_WR);
+}
+
+} // namespace Websocket
@@ -0,0 +1,58 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // EchoServer.h
+#include "LoopbackTransport.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace Websocket
+{
+
+// minimal websocket echo server of loopback benchmarks, built on `FrameDecoder`
+// and `FrameCodec`: performs the HTTP upgrade, echoes text and binary messages,
+// answers pings and close frames, each connection is served by its own thread
+class EchoServer
+{
+public:
+    EchoServer() = default;
+    EchoServer(const EchoServer&) = delete;
+    EchoServer& operator = (const EchoServer&) = delete;
+    ~EchoServer() { stop(); }
+    // starts serving of the listening socket
+    bool start(Socket listener);
+    // stops listening and drops all connections
+    void stop();
+    uint64_t connections() const noexcept { return _connections.load(); }
+
+private:
+    struct Connection
+    {
+        Socket _socket;
+        std::thread _thread;
+    };
+    void acceptLoop();
+    static void serve(Socket& socket);
+
+private:
+    Socket _listener;
+    std::thread _acceptThread;
+    std::atomic<bool> _stopped = false;
+    std::atomic<uint64_t> _connections = 0U;
+    std::mutex _mutex;
+    std::list<Connection> _active;
+};
+
+} // namespace Websocket
@@ -0,0 +1,74 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketFrameCodec.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace {
+
+using namespace Websocket;
+
+const FrameCodec::MaskKey key = {0x37U, 0xFAU, 0x21U, 0x3DU};
+
+template <void (*Kernel)(uint8_t*, size_t, const FrameCodec::MaskKey&, size_t)>
+void maskPayload(benchmark::State& state) {
+    // odd misalignment, the worst case for vector loads & stores
+    std::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)) + 1U, 0x5AU);
+    for (auto _ : state) {
+        Kernel(buffer.data() + 1, buffer.size() - 1U, key, 0U);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void maskDispatched(uint8_t* data, size_t size, const FrameCodec::MaskKey& key, size_t offset) {
+    FrameCodec::mask(data, size, key, offset);
+}
+
+#ifdef WEBSOCKET_FRAME_CODEC_AVX2
+void maskAvx2(benchmark::State& state) {
+    if (FrameCodec::Details::hasAvx2()) {
+        maskPayload<FrameCodec::Details::maskAvx2>(state);
+    }
+    else {
+        state.SkipWithError("AVX2 is not supported by CPU");
+    }
+}
+#endif
+
+void writeHeader(benchmark::State& state) {
+    uint8_t out[FrameCodec::MaxHeaderSize];
+    uint64_t payloadSize = static_cast<uint64_t>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(payloadSize);
+        benchmark::DoNotOptimize(FrameCodec::writeHeader(out, Opcode::Binary, true, payloadSize, &key));
+        benchmark::ClobberMemory();
+    }
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(maskPayload, maskDispatched)->RangeMultiplier(8)->Range(8, 1 << 20);
+BENCHMARK_TEMPLATE(maskPayload, FrameCodec::Details::maskScalar)->RangeMultiplier(8)->Range(8, 1 << 20);
+#ifdef WEBSOCKET_FRAME_CODEC_SSE2
+BENCHMARK_TEMPLATE(maskPayload, FrameCodec::Details::maskSse2)->RangeMultiplier(8)->Range(8, 1 << 20);
+#endif
+#ifdef WEBSOCKET_FRAME_CODEC_AVX2
+BENCHMARK(maskAvx2)->RangeMultiplier(8)->Range(8, 1 << 20);
+#endif
+#ifdef WEBSOCKET_FRAME_CODEC_NEON
+BENCHMARK_TEMPLATE(maskPayload, FrameCodec::Details::maskNeon)->RangeMultiplier(8)->Range(8, 1 << 20);
+#endif
+BENCHMARK(writeHeader)->Arg(64)->Arg(1024)->Arg(1 << 20);
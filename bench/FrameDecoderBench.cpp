@@ -0,0 +1,65 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "FrameRecorder.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using namespace Websocket;
+
+class CountingListener : public FrameListener
+{
+public:
+    size_t _messages = 0U;
+    // impl. of FrameListener
+    void onMessageFragment(Opcode, bool, const uint8_t*, size_t, bool, bool last) final {
+        _messages += last ? 1U : 0U;
+    }
+};
+
+// [range(0)] messages of [range(1)] bytes, read by chunks of [range(2)] bytes
+void decodeStream(benchmark::State& state, Opcode opcode, bool server) {
+    const FrameCodec::MaskKey key = {0x01U, 0x02U, 0x03U, 0x04U};
+    const auto messages = static_cast<size_t>(state.range(0));
+    const std::string payload(static_cast<size_t>(state.range(1)), 'w');
+    const auto chunk = static_cast<size_t>(state.range(2));
+    std::vector<uint8_t> stream;
+    for (size_t i = 0U; i < messages; ++i) {
+        appendTestFrame(stream, opcode, payload, true, server ? &key : nullptr);
+    }
+    CountingListener listener;
+    for (auto _ : state) {
+        // unmasking in place spoils payloads of binary messages only, headers stay intact
+        FrameDecoder decoder(listener, server);
+        for (size_t pos = 0U; pos < stream.size(); pos += chunk) {
+            decoder.decode(stream.data() + pos, std::min(chunk, stream.size() - pos));
+        }
+    }
+    benchmark::DoNotOptimize(listener._messages);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+}
+
+void clientText(benchmark::State& state) {
+    decodeStream(state, Opcode::Text, false);
+}
+
+void serverBinary(benchmark::State& state) {
+    decodeStream(state, Opcode::Binary, true);
+}
+
+} // namespace
+
+BENCHMARK(clientText)->Args({1000, 64, 4096})->Args({1000, 64, 1})->Args({16, 65536, 16384});
+BENCHMARK(serverBinary)->Args({1000, 64, 4096})->Args({16, 65536, 16384})->Args({1, 1 << 20, 65536});
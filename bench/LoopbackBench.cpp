@@ -0,0 +1,61 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "InProcessFactory.h"
+#include "LoopbackHarness.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// Runs loopback benchmarks and prints one JSON document (see `toJson`) per line
+// and implementation. Usage: websocket_loopback_bench [--smoke] [--output <file>]
+int main(int argc, char* argv[]) {
+    using namespace Websocket;
+    auto config = LoopbackConfig{};
+    const char* output = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (0 == std::strcmp("--smoke", argv[i])) {
+            config = LoopbackConfig::smoke();
+        }
+        else if (0 == std::strcmp("--output", argv[i]) && i + 1 < argc) {
+            output = argv[++i];
+        }
+        else {
+            std::cerr << "usage: " << argv[0] << " [--smoke] [--output <file>]" << std::endl;
+            return 2;
+        }
+    }
+    std::ofstream file;
+    if (output) {
+        file.open(output);
+        if (!file) {
+            std::cerr << "failed to open " << output << std::endl;
+            return 2;
+        }
+    }
+    std::ostream& os = output ? file : std::cout;
+    bool ok = true;
+    const auto run = [&](std::string_view implementation, const std::vector<BenchmarkResult>& results,
+                         size_t expected) {
+        ok = ok && results.size() == expected;
+        os << toJson(implementation, results) << std::endl;
+    };
+    // TCP vs Unix domain socket, both results in one document for comparison
+    auto baseline = runTransportBaseline(Scheme::Ws, config);
+    const auto unixBaseline = runTransportBaseline(Scheme::Unix, config);
+    baseline.insert(baseline.end(), unixBaseline.begin(), unixBaseline.end());
+    run("FrameCodec", baseline, 10U);
+    // reference in-process transport, the lower bound of `EndPoint` overhead
+    run("InProcessFactory", runLoopbackBenchmarks(InProcessFactory(), Scheme::InProcess, config), 5U);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "LoopbackClient.h"
+
+namespace Websocket
+{
+
+LoopbackClient::LoopbackClient()
+    : _decoder(*this, false)
+    , _buffer(1U << 16U)
+{
+}
+
+bool LoopbackClient::connect(Socket socket, std::string_view resource) {
+    _socket = std::move(socket);
+    _decoder.reset();
+    _received.clear();
+    _closeCode = 0U;
+    if (!_socket.valid()) {
+        return false;
+    }
+    static const std::string_view key = "dGhlIHNhbXBsZSBub25jZQ==";
+    std::string request = "GET ";
+    request += resource;
+    request += " HTTP/1.1\r\n"
+               "Host: localhost\r\n"
+               "Upgrade: websocket\r\n"
+               "Connection: Upgrade\r\n"
+               "Sec-WebSocket-Version: 13\r\n"
+               "Sec-WebSocket-Key: ";
+    request += key;
+    request += "\r\n\r\n";
+    if (!_socket.sendAll(request.data(), request.size())) {
+        return false;
+    }
+    std::string response;
+    size_t headerEnd = std::string::npos;
+    while (std::string::npos == headerEnd) {
+        const auto received = _socket.receive(_buffer.data(), _buffer.size());
+        if (received <= 0) {
+            return false;
+        }
+        response.append(reinterpret_cast<const char*>(_buffer.data()), static_cast<size_t>(received));
+        headerEnd = response.find("\r\n\r\n");
+    }
+    if (0U != response.rfind("HTTP/1.1 101", 0U) ||
+        headerValue(std::string_view(response).substr(0U, headerEnd + 2U), "Sec-WebSocket-Accept") != acceptKey(key)) {
+        return false;
+    }
+    std::vector<uint8_t> pending(response.begin() + static_cast<std::ptrdiff_t>(headerEnd + 4U), response.end());
+    return _decoder.decode(pending.data(), pending.size());
+}
+
+void LoopbackClient::queue(Opcode opcode, const uint8_t* payload, size_t size) {
+    const auto key = nextKey();
+    appendFrame(_output, opcode, payload, size, &key);
+}
+
+bool LoopbackClient::flush() {
+    const bool ok = _socket.sendAll(_output.data(), _output.size());
+    _output.clear();
+    return ok;
+}
+
+bool LoopbackClient::send(Opcode opcode, const uint8_t* payload, size_t size) {
+    queue(opcode, payload, size);
+    return flush();
+}
+
+bool LoopbackClient::sendBatch(Message* messages, size_t count) {
+    _headers.resize(count * FrameCodec::MaxHeaderSize);
+    _parts.clear();
+    for (size_t i = 0U; i < count; ++i) {
+        auto& payload = messages[i]._payload;
+        const auto key = nextKey();
+        auto* header = _headers.data() + i * FrameCodec::MaxHeaderSize;
+        _parts.push_back({header, FrameCodec::writeHeader(header, messages[i]._opcode, true, payload.size(), &key)});
+        if (!payload.empty()) {
+            FrameCodec::mask(payload.data(), payload.size(), key);
+            _parts.push_back({payload.data(), payload.size()});
+        }
+    }
+    return _socket.sendAll(_parts.data(), _parts.size());
+}
+
+bool LoopbackClient::receive(Message& message) {
+    while (_received.empty()) {
+        if (_decoder.failed() || _decoder.closed()) {
+            return false;
+        }
+        const auto received = _socket.receive(_buffer.data(), _buffer.size());
+        if (received <= 0) {
+            return false;
+        }
+        _decoder.decode(_buffer.data(), static_cast<size_t>(received));
+    }
+    message = std::move(_received.front());
+    _received.pop_front();
+    return true;
+}
+
+void LoopbackClient::close(uint16_t code) {
+    if (_socket.valid()) {
+        const uint8_t payload[2] = {static_cast<uint8_t>(code >> 8), static_cast<uint8_t>(code)};
+        if (send(Opcode::Close, payload, sizeof(payload))) {
+            Message message;
+            while (receive(message)) {
+            }
+        }
+        _socket.close();
+    }
+}
+
+FrameCodec::MaskKey LoopbackClient::nextKey() noexcept {
+    // xorshift64, masking keys of benchmarks don't need to be cryptographically strong
+    _random ^= _random << 13;
+    _random ^= _random >> 7;
+    _random ^= _random << 17;
+    return {static_cast<uint8_t>(_random), static_cast<uint8_t>(_random >> 8),
+            static_cast<uint8_t>(_random >> 16), static_cast<uint8_t>(_random >> 24)};
+}
+
+void LoopbackClient::onMessageFragment(Opcode opcode, bool /*compressed*/, const uint8_t* data,
+                                       size_t size, bool first, bool last) {
+    if (first) {
+        _partial._opcode = opcode;
+        _partial._payload.clear();
+    }
+    _partial._payload.insert(_partial._payload.end(), data, data + size);
+    if (last) {
+        _received.push_back(std::move(_partial));
+        _partial = {};
+    }
+}
+
+void LoopbackClient::onPong(const uint8_t* payload, size_t size) {
+    _received.push_back({Opcode::Pong, std::vector<uint8_t>(payload, payload + size)});
+}
+
+void LoopbackClient::onClose(uint16_t code, std::string_view /*reason*/) {
+    _closeCode = code;
+}
+
+void LoopbackClient::onProtocolError(uint16_t closeCode, std::string_view /*details*/) {
+    _closeCode = closeCode;
+}
+
+} // namespace Websocket
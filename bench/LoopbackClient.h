@@ -0,0 +1,72 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // LoopbackClient.h
+#include "LoopbackTransport.h"
+#include "WebsocketFrameDecoder.h"
+#include <deque>
+
+namespace Websocket
+{
+
+// blocking websocket client built directly on `FrameCodec` and `FrameDecoder`,
+// the transport baseline of loopback benchmarks (no `EndPoint` overhead)
+class LoopbackClient : private FrameListener
+{
+public:
+    struct Message
+    {
+        Opcode _opcode = Opcode::Binary;
+        std::vector<uint8_t> _payload;
+    };
+    LoopbackClient();
+    // performs the HTTP upgrade over the connected socket
+    bool connect(Socket socket, std::string_view resource = "/");
+    // appends the masked frame to the output buffer
+    void queue(Opcode opcode, const uint8_t* payload, size_t size);
+    // writes the output buffer
+    bool flush();
+    bool send(Opcode opcode, const uint8_t* payload, size_t size);
+    // frames all messages in one pass and writes them by a single vectored write without
+    // copying of payloads, which are masked in place, i.e. consumed by the call
+    bool sendBatch(Message* messages, size_t count);
+    // blocks until the next data message or pong
+    bool receive(Message& message);
+    // performs the closing handshake and closes the socket
+    void close(uint16_t code = CloseCode::Normal);
+    uint16_t closeCode() const noexcept { return _closeCode; }
+
+private:
+    FrameCodec::MaskKey nextKey() noexcept;
+    // impl. of FrameListener
+    void onMessageFragment(Opcode opcode, bool compressed, const uint8_t* data, size_t size,
+                           bool first, bool last) final;
+    void onPong(const uint8_t* payload, size_t size) final;
+    void onClose(uint16_t code, std::string_view reason) final;
+    void onProtocolError(uint16_t closeCode, std::string_view details) final;
+
+private:
+    Socket _socket;
+    FrameDecoder _decoder;
+    uint64_t _random = 0x9E3779B97F4A7C15ULL;
+    std::vector<uint8_t> _buffer;
+    std::vector<uint8_t> _output;
+    // headers & parts of the vectored write of `sendBatch`
+    std::vector<uint8_t> _headers;
+    std::vector<iovec> _parts;
+    std::deque<Message> _received;
+    Message _partial;
+    uint16_t _closeCode = 0U;
+};
+
+} // namespace Websocket
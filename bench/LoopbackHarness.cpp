@@ -0,0 +1,590 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "LoopbackHarness.h"
+#include "AllocationCounter.h"
+#include "BytesBlob.h"
+#include "EchoServer.h"
+#include "LoopbackClient.h"
+#include "WebsocketEndPoint.h"
+#include "WebsocketFactory.h"
+#include "WebsocketListener.h"
+#include "WebsocketState.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+using namespace Websocket;
+using Clock = std::chrono::steady_clock;
+
+class Latencies
+{
+public:
+    void add(Clock::duration latency) { _samples.push_back(latency); }
+    void append(const Latencies& other) {
+        _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+    }
+    void fill(BenchmarkResult& result);
+
+private:
+    std::chrono::nanoseconds percentile(double fraction) const;
+
+private:
+    std::vector<std::chrono::nanoseconds> _samples;
+};
+
+// wall-clock time & heap allocations of the process (harness, endpoints and the echo server)
+class Measurement
+{
+public:
+    // ends the measured section
+    void stop() {
+        _elapsed = Clock::now() - _start;
+        _allocations = allocationCount() - _allocationsAtStart;
+    }
+    Clock::duration elapsed() const noexcept { return _elapsed; }
+    uint64_t allocations() const noexcept { return _allocations; }
+
+private:
+    const uint64_t _allocationsAtStart = allocationCount();
+    const Clock::time_point _start = Clock::now();
+    Clock::duration _elapsed = {};
+    uint64_t _allocations = 0U;
+};
+
+// bundled echo server of the transport
+class EchoTarget
+{
+public:
+    ~EchoTarget();
+    bool start(Scheme transport);
+    Socket connect() const;
+    std::string url() const;
+
+private:
+    Scheme _transport = Scheme::Unknown;
+    EchoServer _server;
+    uint16_t _port = 0U;
+    std::string _path;
+};
+
+// records events of the endpoint for the harness thread
+class HarnessListener : public Listener
+{
+public:
+    bool waitState(State state, std::chrono::milliseconds timeout);
+    // waits until the number of received messages & pongs reaches [count]
+    bool waitReceived(size_t count, std::chrono::milliseconds timeout);
+    std::vector<Clock::time_point> takeReceived();
+    // impl. of Listener
+    void onStateChanged(uint64_t, uint64_t, State state) final;
+    void onTextMessage(uint64_t, uint64_t, const std::string_view&) final { received(); }
+    void onBinaryMessage(uint64_t, uint64_t, const Bricks::Blob&) final { received(); }
+    void onPong(uint64_t, uint64_t, const Bricks::Blob&) final { received(); }
+
+private:
+    void received();
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    State _state = State::Disconnected;
+    std::vector<Clock::time_point> _received;
+};
+
+// echoes all messages of endpoints accepted by the factory
+class EchoAcceptorListener : public AcceptorListener
+{
+    class Echo : public Listener
+    {
+    public:
+        explicit Echo(EndPoint& endPoint) : _endPoint(endPoint) {}
+        void onTextMessage(uint64_t, uint64_t, const std::string_view& message) final {
+            _endPoint.sendText(message);
+        }
+        void onSharedBinaryMessage(uint64_t, uint64_t, std::shared_ptr<const Bricks::Blob> message) final {
+            _endPoint.sendSharedBinary(std::move(message));
+        }
+
+    private:
+        EndPoint& _endPoint;
+    };
+
+public:
+    void onAccepted(std::unique_ptr<EndPoint> endPoint, uint64_t) final {
+        endPoint->setListener(std::make_shared<Echo>(*endPoint));
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _endPoints.push_back(std::move(endPoint));
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<EndPoint>> _endPoints;
+};
+
+void Latencies::fill(BenchmarkResult& result) {
+    std::sort(_samples.begin(), _samples.end());
+    result._latencyP50 = percentile(0.5);
+    result._latencyP99 = percentile(0.99);
+    result._latencyP999 = percentile(0.999);
+}
+
+std::chrono::nanoseconds Latencies::percentile(double fraction) const {
+    if (_samples.empty()) {
+        return {};
+    }
+    const auto rank = static_cast<size_t>(fraction * static_cast<double>(_samples.size() - 1U) + 0.5);
+    return _samples[std::min(rank, _samples.size() - 1U)];
+}
+
+EchoTarget::~EchoTarget() {
+    _server.stop();
+    if (!_path.empty()) {
+        ::unlink(_path.c_str());
+    }
+}
+
+bool EchoTarget::start(Scheme transport) {
+    _transport = transport;
+    if (Scheme::Ws == transport) {
+        auto listener = listenTcp();
+        _port = localPort(listener);
+        return _server.start(std::move(listener));
+    }
+    if (Scheme::Unix == transport) {
+        _path = "/tmp/websocket-loopback-" + std::to_string(::getpid()) + ".sock";
+        return _server.start(listenUnix(_path));
+    }
+    return false;
+}
+
+Socket EchoTarget::connect() const {
+    if (Scheme::Ws == _transport) {
+        return connectTcp(_port);
+    }
+    if (Scheme::Unix == _transport) {
+        return connectUnix(_path);
+    }
+    return {};
+}
+
+std::string EchoTarget::url() const {
+    if (Scheme::Ws == _transport) {
+        return "ws://127.0.0.1:" + std::to_string(_port) + "/";
+    }
+    if (Scheme::Unix == _transport) {
+        return "ws+unix://" + _path + ":/";
+    }
+    return {};
+}
+
+bool HarnessListener::waitState(State state, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _condition.wait_for(lock, timeout, [this, state]() { return state == _state; });
+}
+
+bool HarnessListener::waitReceived(size_t count, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _condition.wait_for(lock, timeout, [this, count]() { return _received.size() >= count; });
+}
+
+std::vector<Clock::time_point> HarnessListener::takeReceived() {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    return std::move(_received);
+}
+
+void HarnessListener::onStateChanged(uint64_t, uint64_t, State state) {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    _state = state;
+    _condition.notify_all();
+}
+
+void HarnessListener::received() {
+    const auto now = Clock::now();
+    const std::lock_guard<std::mutex> lock(_mutex);
+    _received.push_back(now);
+    _condition.notify_all();
+}
+
+BenchmarkResult makeResult(BenchmarkScenario scenario, Scheme transport, size_t operations,
+                           size_t bytes, const Measurement& measurement, Latencies& latencies) {
+    BenchmarkResult result;
+    result._scenario = scenario;
+    result._transport = transport;
+    result._operations = operations;
+    result._bytes = bytes;
+    result._allocations = measurement.allocations();
+    result._elapsed = measurement.elapsed();
+    latencies.fill(result);
+    return result;
+}
+
+void report(BenchmarkScenario scenario, Scheme transport) {
+    std::cerr << toString(scenario) << " over " << toString(transport) << " failed" << std::endl;
+}
+
+// transport baseline
+
+bool rawPipeline(LoopbackClient& client, Opcode opcode, size_t count, size_t size,
+                 size_t window, Latencies& latencies) {
+    const std::vector<uint8_t> payload(size, uint8_t('x'));
+    std::deque<Clock::time_point> inFlight;
+    LoopbackClient::Message message;
+    for (size_t sent = 0U, received = 0U; received < count; ++received) {
+        for (; sent < count && sent - received < window; ++sent) {
+            inFlight.push_back(Clock::now());
+            client.queue(opcode, payload.data(), payload.size());
+        }
+        if (!client.flush() || !client.receive(message) || message._payload.size() != size) {
+            return false;
+        }
+        latencies.add(Clock::now() - inFlight.front());
+        inFlight.pop_front();
+    }
+    return true;
+}
+
+std::optional<BenchmarkResult> rawConnectRate(const EchoTarget& target, Scheme transport,
+                                              const LoopbackConfig& config) {
+    Latencies latencies;
+    Measurement measurement;
+    for (size_t i = 0U; i < config._connections; ++i) {
+        const auto connectStart = Clock::now();
+        LoopbackClient client;
+        if (!client.connect(target.connect())) {
+            return std::nullopt;
+        }
+        latencies.add(Clock::now() - connectStart);
+        client.close();
+    }
+    measurement.stop();
+    return makeResult(BenchmarkScenario::ConnectRate, transport, config._connections, 0U,
+                      measurement, latencies);
+}
+
+std::optional<BenchmarkResult> rawThroughput(const EchoTarget& target, Scheme transport,
+                                             BenchmarkScenario scenario, Opcode opcode,
+                                             size_t count, size_t size, size_t window) {
+    LoopbackClient client;
+    if (!client.connect(target.connect())) {
+        return std::nullopt;
+    }
+    Latencies latencies;
+    Measurement measurement;
+    if (!rawPipeline(client, opcode, count, size, window, latencies)) {
+        return std::nullopt;
+    }
+    measurement.stop();
+    client.close();
+    return makeResult(scenario, transport, count, count * size, measurement, latencies);
+}
+
+std::optional<BenchmarkResult> rawPingRtt(const EchoTarget& target, Scheme transport,
+                                          const LoopbackConfig& config) {
+    LoopbackClient client;
+    if (!client.connect(target.connect())) {
+        return std::nullopt;
+    }
+    Latencies latencies;
+    LoopbackClient::Message message;
+    Measurement measurement;
+    for (size_t i = 0U; i < config._pings; ++i) {
+        const auto pingStart = Clock::now();
+        if (!client.send(Opcode::Ping, nullptr, 0U) || !client.receive(message) ||
+            Opcode::Pong != message._opcode) {
+            return std::nullopt;
+        }
+        latencies.add(Clock::now() - pingStart);
+    }
+    measurement.stop();
+    client.close();
+    return makeResult(BenchmarkScenario::PingRtt, transport, config._pings, 0U, measurement, latencies);
+}
+
+std::optional<BenchmarkResult> rawLatencyUnderLoad(const EchoTarget& target, Scheme transport,
+                                                   const LoopbackConfig& config) {
+    std::vector<Latencies> latencies(config._loadConnections);
+    std::vector<std::thread> threads;
+    std::atomic<bool> ok = true;
+    Measurement measurement;
+    for (size_t i = 0U; i < config._loadConnections; ++i) {
+        threads.emplace_back([&, i]() {
+            LoopbackClient client;
+            if (!client.connect(target.connect()) ||
+                !rawPipeline(client, Opcode::Text, config._loadMessages, config._loadMessageSize,
+                             config._window, latencies[i])) {
+                ok = false;
+            }
+            client.close();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (!ok) {
+        return std::nullopt;
+    }
+    measurement.stop();
+    for (size_t i = 1U; i < latencies.size(); ++i) {
+        latencies.front().append(latencies[i]);
+    }
+    const auto operations = config._loadConnections * config._loadMessages;
+    return makeResult(BenchmarkScenario::LatencyUnderLoad, transport, operations,
+                      operations * config._loadMessageSize, measurement, latencies.front());
+}
+
+// endpoints of the factory
+
+struct Connection
+{
+    std::shared_ptr<HarnessListener> _listener = std::make_shared<HarnessListener>();
+    std::unique_ptr<EndPoint> _endPoint;
+};
+
+bool connect(const Factory& factory, const std::string& url, uint64_t connectionId,
+             const LoopbackConfig& config, Connection& connection) {
+    connection._endPoint = factory.create();
+    if (!connection._endPoint) {
+        return false;
+    }
+    connection._endPoint->setListener(connection._listener);
+    Options options;
+    options._host = url;
+    return connection._endPoint->open(std::move(options), connectionId) &&
+           connection._listener->waitState(State::Connected, config._timeout);
+}
+
+bool disconnect(Connection& connection, const LoopbackConfig& config) {
+    connection._endPoint->close();
+    return connection._listener->waitState(State::Disconnected, config._timeout);
+}
+
+bool endPointPipeline(Connection& connection, Opcode opcode, size_t count, size_t size,
+                      const LoopbackConfig& config, Latencies& latencies) {
+    const std::string text(size, 'x');
+    const BytesBlob binary(text);
+    std::vector<Clock::time_point> sent(count);
+    for (size_t i = 0U; i < count; ++i) {
+        if (i >= config._window && !connection._listener->waitReceived(i + 1U - config._window, config._timeout)) {
+            return false;
+        }
+        sent[i] = Clock::now();
+        if (!(Opcode::Text == opcode ? connection._endPoint->sendText(text) :
+                                       connection._endPoint->sendBinary(binary))) {
+            return false;
+        }
+    }
+    if (!connection._listener->waitReceived(count, config._timeout)) {
+        return false;
+    }
+    const auto received = connection._listener->takeReceived();
+    for (size_t i = 0U; i < count; ++i) {
+        latencies.add(received[i] - sent[i]);
+    }
+    return true;
+}
+
+std::optional<BenchmarkResult> endPointConnectRate(const Factory& factory, const std::string& url,
+                                                   Scheme transport, const LoopbackConfig& config) {
+    Latencies latencies;
+    Measurement measurement;
+    for (size_t i = 0U; i < config._connections; ++i) {
+        const auto connectStart = Clock::now();
+        Connection connection;
+        if (!connect(factory, url, i + 1U, config, connection)) {
+            return std::nullopt;
+        }
+        latencies.add(Clock::now() - connectStart);
+        if (!disconnect(connection, config)) {
+            return std::nullopt;
+        }
+    }
+    measurement.stop();
+    return makeResult(BenchmarkScenario::ConnectRate, transport, config._connections, 0U,
+                      measurement, latencies);
+}
+
+std::optional<BenchmarkResult> endPointThroughput(const Factory& factory, const std::string& url,
+                                                  Scheme transport, BenchmarkScenario scenario,
+                                                  Opcode opcode, size_t count, size_t size,
+                                                  const LoopbackConfig& config) {
+    Connection connection;
+    if (!connect(factory, url, 1U, config, connection)) {
+        return std::nullopt;
+    }
+    Latencies latencies;
+    Measurement measurement;
+    if (!endPointPipeline(connection, opcode, count, size, config, latencies)) {
+        return std::nullopt;
+    }
+    measurement.stop();
+    disconnect(connection, config);
+    return makeResult(scenario, transport, count, count * size, measurement, latencies);
+}
+
+std::optional<BenchmarkResult> endPointPingRtt(const Factory& factory, const std::string& url,
+                                               Scheme transport, const LoopbackConfig& config) {
+    Connection connection;
+    if (!connect(factory, url, 1U, config, connection)) {
+        return std::nullopt;
+    }
+    Latencies latencies;
+    Measurement measurement;
+    for (size_t i = 0U; i < config._pings; ++i) {
+        const auto pingStart = Clock::now();
+        if (!connection._endPoint->ping() || !connection._listener->waitReceived(i + 1U, config._timeout)) {
+            return std::nullopt;
+        }
+        latencies.add(Clock::now() - pingStart);
+    }
+    measurement.stop();
+    disconnect(connection, config);
+    return makeResult(BenchmarkScenario::PingRtt, transport, config._pings, 0U, measurement, latencies);
+}
+
+std::optional<BenchmarkResult> endPointLatencyUnderLoad(const Factory& factory, const std::string& url,
+                                                        Scheme transport, const LoopbackConfig& config) {
+    std::vector<Connection> connections(config._loadConnections);
+    for (size_t i = 0U; i < connections.size(); ++i) {
+        if (!connect(factory, url, i + 1U, config, connections[i])) {
+            return std::nullopt;
+        }
+    }
+    std::vector<Latencies> latencies(config._loadConnections);
+    std::vector<std::thread> threads;
+    std::atomic<bool> ok = true;
+    Measurement measurement;
+    for (size_t i = 0U; i < connections.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            if (!endPointPipeline(connections[i], Opcode::Text, config._loadMessages,
+                                  config._loadMessageSize, config, latencies[i])) {
+                ok = false;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    measurement.stop();
+    for (auto& connection : connections) {
+        disconnect(connection, config);
+    }
+    if (!ok) {
+        return std::nullopt;
+    }
+    for (size_t i = 1U; i < latencies.size(); ++i) {
+        latencies.front().append(latencies[i]);
+    }
+    const auto operations = config._loadConnections * config._loadMessages;
+    return makeResult(BenchmarkScenario::LatencyUnderLoad, transport, operations,
+                      operations * config._loadMessageSize, measurement, latencies.front());
+}
+
+void collect(std::vector<BenchmarkResult>& results, BenchmarkScenario scenario, Scheme transport,
+             std::optional<BenchmarkResult> result) {
+    if (result) {
+        results.push_back(std::move(*result));
+    }
+    else {
+        report(scenario, transport);
+    }
+}
+
+} // namespace
+
+namespace Websocket
+{
+
+LoopbackConfig LoopbackConfig::smoke() {
+    LoopbackConfig config;
+    config._connections = 10U;
+    config._smallMessages = 1000U;
+    config._largeMessages = 4U;
+    config._pings = 100U;
+    config._loadConnections = 2U;
+    config._loadMessages = 500U;
+    config._timeout = std::chrono::seconds(10);
+    return config;
+}
+
+std::vector<BenchmarkResult> runTransportBaseline(Scheme transport, const LoopbackConfig& config) {
+    std::vector<BenchmarkResult> results;
+    EchoTarget target;
+    if (target.start(transport)) {
+        collect(results, BenchmarkScenario::ConnectRate, transport, rawConnectRate(target, transport, config));
+        collect(results, BenchmarkScenario::SmallMessageThroughput, transport,
+                rawThroughput(target, transport, BenchmarkScenario::SmallMessageThroughput, Opcode::Text,
+                              config._smallMessages, config._smallMessageSize, config._window));
+        collect(results, BenchmarkScenario::LargeMessageThroughput, transport,
+                rawThroughput(target, transport, BenchmarkScenario::LargeMessageThroughput, Opcode::Binary,
+                              config._largeMessages, config._largeMessageSize, 1U));
+        collect(results, BenchmarkScenario::PingRtt, transport, rawPingRtt(target, transport, config));
+        collect(results, BenchmarkScenario::LatencyUnderLoad, transport,
+                rawLatencyUnderLoad(target, transport, config));
+    }
+    return results;
+}
+
+std::vector<BenchmarkResult> runLoopbackBenchmarks(const Factory& factory, Scheme transport,
+                                                   const LoopbackConfig& config) {
+    std::vector<BenchmarkResult> results;
+    if (!factory.supportsScheme(transport)) {
+        return results;
+    }
+    EchoTarget target;
+    std::unique_ptr<Acceptor> acceptor;
+    std::string url;
+    if (Scheme::InProcess == transport) {
+        acceptor = factory.createAcceptor();
+        AcceptorOptions options;
+        options._address = "inproc://loopback-echo";
+        if (!acceptor || !acceptor->start(std::move(options), std::make_shared<EchoAcceptorListener>())) {
+            return results;
+        }
+        url = "inproc://loopback-echo/";
+    }
+    else if (target.start(transport)) {
+        url = target.url();
+    }
+    else {
+        return results;
+    }
+    collect(results, BenchmarkScenario::ConnectRate, transport,
+            endPointConnectRate(factory, url, transport, config));
+    collect(results, BenchmarkScenario::SmallMessageThroughput, transport,
+            endPointThroughput(factory, url, transport, BenchmarkScenario::SmallMessageThroughput,
+                               Opcode::Text, config._smallMessages, config._smallMessageSize, config));
+    auto large = config;
+    large._window = 1U;
+    collect(results, BenchmarkScenario::LargeMessageThroughput, transport,
+            endPointThroughput(factory, url, transport, BenchmarkScenario::LargeMessageThroughput,
+                               Opcode::Binary, config._largeMessages, config._largeMessageSize, large));
+    collect(results, BenchmarkScenario::PingRtt, transport, endPointPingRtt(factory, url, transport, config));
+    collect(results, BenchmarkScenario::LatencyUnderLoad, transport,
+            endPointLatencyUnderLoad(factory, url, transport, config));
+    if (acceptor) {
+        acceptor->stop();
+    }
+    return results;
+}
+
+} // namespace Websocket
@@ -0,0 +1,56 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // LoopbackHarness.h
+#include "BenchmarkResult.h"
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace Websocket
+{
+
+class Factory;
+
+// sizes of loopback benchmark scenarios
+struct LoopbackConfig
+{
+    size_t _connections = 500U;
+    size_t _smallMessages = 200000U;
+    size_t _smallMessageSize = 64U;
+    size_t _largeMessages = 64U;
+    size_t _largeMessageSize = size_t(1) << 20U;
+    size_t _pings = 5000U;
+    // latency under load: concurrent connections, each with [_window] messages in flight
+    size_t _loadConnections = 8U;
+    size_t _loadMessages = 20000U;
+    size_t _loadMessageSize = 512U;
+    // maximal number of messages in flight per connection
+    size_t _window = 64U;
+    std::chrono::milliseconds _timeout = std::chrono::seconds(60);
+    // tiny sizes for smoke runs in CTest
+    static LoopbackConfig smoke();
+};
+
+// runs all scenarios by `LoopbackClient` against the bundled echo server,
+// the baseline of the transport without `EndPoint` overhead, empty result if
+// the transport is not supported (`Scheme::Ws` and `Scheme::Unix` are)
+std::vector<BenchmarkResult> runTransportBaseline(Scheme transport, const LoopbackConfig& config);
+
+// runs all scenarios by endpoints of the factory against the bundled echo server
+// (`Scheme::Ws`, `Scheme::Unix`) or against the echo acceptor of the factory (`Scheme::InProcess`),
+// empty result if the transport is not supported by the factory
+std::vector<BenchmarkResult> runLoopbackBenchmarks(const Factory& factory, Scheme transport,
+                                                   const LoopbackConfig& config);
+
+} // namespace Websocket
@@ -0,0 +1,316 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "LoopbackTransport.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+using Sha1Digest = std::array<uint8_t, 20U>;
+
+inline uint32_t rotl(uint32_t value, unsigned bits) {
+    return (value << bits) | (value >> (32U - bits));
+}
+
+Sha1Digest sha1(std::string_view input) {
+    uint32_t h[5] = {0x67452301U, 0xEFCDAB89U, 0x98BADCFEU, 0x10325476U, 0xC3D2E1F0U};
+    std::string message(input);
+    const uint64_t bits = uint64_t(input.size()) * 8U;
+    message += static_cast<char>(0x80);
+    while (message.size() % 64U != 56U) {
+        message += '\0';
+    }
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        message += static_cast<char>((bits >> shift) & 0xFFU);
+    }
+    for (size_t chunk = 0U; chunk < message.size(); chunk += 64U) {
+        uint32_t w[80];
+        for (size_t i = 0U; i < 16U; ++i) {
+            const auto* p = reinterpret_cast<const uint8_t*>(message.data() + chunk + i * 4U);
+            w[i] = (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+        }
+        for (size_t i = 16U; i < 80U; ++i) {
+            w[i] = rotl(w[i - 3U] ^ w[i - 8U] ^ w[i - 14U] ^ w[i - 16U], 1U);
+        }
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (size_t i = 0U; i < 80U; ++i) {
+            uint32_t f, k;
+            if (i < 20U) {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999U;
+            }
+            else if (i < 40U) {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1U;
+            }
+            else if (i < 60U) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDCU;
+            }
+            else {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6U;
+            }
+            const uint32_t temp = rotl(a, 5U) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl(b, 30U);
+            b = a;
+            a = temp;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+    Sha1Digest digest;
+    for (size_t i = 0U; i < 5U; ++i) {
+        for (size_t j = 0U; j < 4U; ++j) {
+            digest[i * 4U + j] = static_cast<uint8_t>(h[i] >> (24U - j * 8U));
+        }
+    }
+    return digest;
+}
+
+std::string base64(const uint8_t* data, size_t size) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string output;
+    for (size_t i = 0U; i < size; i += 3U) {
+        const uint32_t n = (uint32_t(data[i]) << 16) |
+                           (i + 1U < size ? uint32_t(data[i + 1U]) << 8 : 0U) |
+                           (i + 2U < size ? uint32_t(data[i + 2U]) : 0U);
+        output += alphabet[(n >> 18) & 0x3FU];
+        output += alphabet[(n >> 12) & 0x3FU];
+        output += i + 1U < size ? alphabet[(n >> 6) & 0x3FU] : '=';
+        output += i + 2U < size ? alphabet[n & 0x3FU] : '=';
+    }
+    return output;
+}
+
+} // namespace
+
+namespace Websocket
+{
+
+Socket& Socket::operator = (Socket&& other) noexcept {
+    if (this != &other) {
+        close();
+        _fd = other.release();
+    }
+    return *this;
+}
+
+int Socket::release() noexcept {
+    const int fd = _fd;
+    _fd = -1;
+    return fd;
+}
+
+void Socket::close() noexcept {
+    if (valid()) {
+        ::close(release());
+    }
+}
+
+void Socket::shutdown() noexcept {
+    if (valid()) {
+        ::shutdown(_fd, SHUT_RDWR);
+    }
+}
+
+bool Socket::sendAll(const void* data, size_t size) noexcept {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    while (size) {
+        const auto sent = ::send(_fd, bytes, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return false;
+        }
+        bytes += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+bool Socket::sendAll(iovec* parts, size_t count) noexcept {
+    while (count) {
+        msghdr message = {};
+        message.msg_iov = parts;
+        message.msg_iovlen = std::min<size_t>(count, IOV_MAX);
+        auto sent = ::sendmsg(_fd, &message, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return false;
+        }
+        for (; count && static_cast<size_t>(sent) >= parts->iov_len; ++parts, --count) {
+            sent -= static_cast<ssize_t>(parts->iov_len);
+        }
+        if (count) {
+            parts->iov_base = static_cast<uint8_t*>(parts->iov_base) + sent;
+            parts->iov_len -= static_cast<size_t>(sent);
+        }
+    }
+    return true;
+}
+
+long Socket::receive(void* data, size_t size) noexcept {
+    for (;;) {
+        const auto received = ::recv(_fd, data, size, 0);
+        if (received >= 0 || EINTR != errno) {
+            return static_cast<long>(received);
+        }
+    }
+}
+
+Socket listenTcp(uint16_t port) {
+    Socket socket(::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0));
+    if (socket.valid()) {
+        const int yes = 1;
+        ::setsockopt(socket.fd(), SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (0 != ::bind(socket.fd(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) ||
+            0 != ::listen(socket.fd(), SOMAXCONN)) {
+            socket.close();
+        }
+    }
+    return socket;
+}
+
+Socket connectTcp(uint16_t port) {
+    Socket socket(::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0));
+    if (socket.valid()) {
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (0 == ::connect(socket.fd(), reinterpret_cast<const sockaddr*>(&address), sizeof(address))) {
+            const int yes = 1;
+            ::setsockopt(socket.fd(), IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        }
+        else {
+            socket.close();
+        }
+    }
+    return socket;
+}
+
+uint16_t localPort(const Socket& socket) {
+    sockaddr_in address = {};
+    socklen_t size = sizeof(address);
+    if (socket.valid() && 0 == ::getsockname(socket.fd(), reinterpret_cast<sockaddr*>(&address), &size)) {
+        return ntohs(address.sin_port);
+    }
+    return 0U;
+}
+
+Socket listenUnix(const std::string& path) {
+    sockaddr_un address = {};
+    Socket socket;
+    if (path.size() < sizeof(address.sun_path)) {
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.data(), path.size());
+        ::unlink(path.c_str());
+        socket = Socket(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+        if (socket.valid() &&
+            (0 != ::bind(socket.fd(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) ||
+             0 != ::listen(socket.fd(), SOMAXCONN))) {
+            socket.close();
+        }
+    }
+    return socket;
+}
+
+Socket connectUnix(const std::string& path) {
+    sockaddr_un address = {};
+    Socket socket;
+    if (path.size() < sizeof(address.sun_path)) {
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.data(), path.size());
+        socket = Socket(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+        if (socket.valid() &&
+            0 != ::connect(socket.fd(), reinterpret_cast<const sockaddr*>(&address), sizeof(address))) {
+            socket.close();
+        }
+    }
+    return socket;
+}
+
+void appendFrame(std::vector<uint8_t>& out, Opcode opcode, const uint8_t* payload, size_t size,
+                 const FrameCodec::MaskKey* key) {
+    const auto offset = out.size();
+    out.resize(offset + FrameCodec::headerSize(size, nullptr != key) + size);
+    const auto header = FrameCodec::writeHeader(out.data() + offset, opcode, true, size, key);
+    if (size) {
+        std::memcpy(out.data() + offset + header, payload, size);
+        if (key) {
+            FrameCodec::mask(out.data() + offset + header, size, *key);
+        }
+    }
+}
+
+std::string acceptKey(std::string_view key) {
+    std::string input(key);
+    input += "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    const auto digest = sha1(input);
+    return base64(digest.data(), digest.size());
+}
+
+std::string_view headerValue(std::string_view request, std::string_view name) {
+    size_t line = request.find("\r\n");
+    while (std::string_view::npos != line) {
+        line += 2U;
+        const auto end = request.find("\r\n", line);
+        const auto header = request.substr(line, std::string_view::npos == end ? end : end - line);
+        const auto colon = header.find(':');
+        if (colon == name.size()) {
+            bool equals = true;
+            for (size_t i = 0U; i < colon && equals; ++i) {
+                equals = std::tolower(static_cast<unsigned char>(header[i])) ==
+                         std::tolower(static_cast<unsigned char>(name[i]));
+            }
+            if (equals) {
+                auto value = header.substr(colon + 1U);
+                while (!value.empty() && ' ' == value.front()) {
+                    value.remove_prefix(1U);
+                }
+                while (!value.empty() && ' ' == value.back()) {
+                    value.remove_suffix(1U);
+                }
+                return value;
+            }
+        }
+        line = end;
+    }
+    return {};
+}
+
+} // namespace Websocket
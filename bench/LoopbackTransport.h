@@ -0,0 +1,72 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // LoopbackTransport.h
+#include "WebsocketFrameCodec.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sys/uio.h>
+
+namespace Websocket
+{
+
+// POSIX socket helpers of loopback benchmarks
+
+// owner of a socket descriptor
+class Socket
+{
+public:
+    Socket() = default;
+    explicit Socket(int fd) noexcept : _fd(fd) {}
+    Socket(Socket&& other) noexcept : _fd(other.release()) {}
+    Socket& operator = (Socket&& other) noexcept;
+    Socket(const Socket&) = delete;
+    Socket& operator = (const Socket&) = delete;
+    ~Socket() { close(); }
+    int fd() const noexcept { return _fd; }
+    bool valid() const noexcept { return _fd >= 0; }
+    int release() noexcept;
+    void close() noexcept;
+    // wakes up threads blocked in reads or accept
+    void shutdown() noexcept;
+    bool sendAll(const void* data, size_t size) noexcept;
+    // vectored write of all parts by `sendmsg`, [parts] are advanced on partial writes
+    bool sendAll(iovec* parts, size_t count) noexcept;
+    // returns 0 on EOF, negative value on error
+    long receive(void* data, size_t size) noexcept;
+
+private:
+    int _fd = -1;
+};
+
+// listens on 127.0.0.1, port 0 means any free port
+Socket listenTcp(uint16_t port = 0U);
+Socket connectTcp(uint16_t port);
+uint16_t localPort(const Socket& socket);
+// Unix domain stream sockets, an existing socket file at [path] is replaced
+Socket listenUnix(const std::string& path);
+Socket connectUnix(const std::string& path);
+
+// appends the complete frame, the payload is masked if the key is specified
+void appendFrame(std::vector<uint8_t>& out, Opcode opcode, const uint8_t* payload, size_t size,
+                 const FrameCodec::MaskKey* key = nullptr);
+
+// value of Sec-WebSocket-Accept header for the Sec-WebSocket-Key
+std::string acceptKey(std::string_view key);
+// value of the HTTP header (case-insensitive name), empty if missing
+std::string_view headerValue(std::string_view request, std::string_view name);
+
+} // namespace Websocket
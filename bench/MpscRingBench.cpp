@@ -0,0 +1,185 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketMpscRing.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace Websocket;
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t itemsPerRound = 10000U;
+// one of this number of enqueues is timed, so that reading of the clock doesn't dominate throughput
+constexpr size_t latencySampling = 8U;
+
+// the baseline: queue guarded by a mutex
+class LockedQueue
+{
+public:
+    bool tryPush(size_t&& value) {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _items.push_back(value);
+        return true;
+    }
+    template <class Consumer>
+    size_t popBatch(Consumer&& consumer, size_t maxCount) {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        size_t count = 0U;
+        for (; count < maxCount && !_items.empty(); ++count) {
+            consumer(std::move(_items.front()));
+            _items.pop_front();
+        }
+        return count;
+    }
+
+private:
+    std::mutex _mutex;
+    std::deque<size_t> _items;
+};
+
+// producer threads living for the whole benchmark, each round every producer enqueues
+// [itemsPerRound] items, including retries while the queue is full
+template <class Queue>
+class Producers
+{
+public:
+    Producers(Queue& queue, size_t count);
+    ~Producers() { stop(); }
+    void startRound() { _round.fetch_add(1U, std::memory_order_release); }
+    // joins threads after the current round
+    void stop();
+    // latencies of sampled enqueues of all producers, valid after `stop` only
+    std::vector<Clock::duration> latencies() const;
+
+private:
+    void run(size_t producer);
+
+private:
+    Queue& _queue;
+    std::atomic<uint64_t> _round = 0U;
+    std::atomic<bool> _stopped = false;
+    std::vector<std::vector<Clock::duration>> _latencies;
+    std::vector<std::thread> _threads;
+};
+
+template <class Queue>
+Producers<Queue>::Producers(Queue& queue, size_t count)
+    : _queue(queue)
+    , _latencies(count)
+{
+    for (size_t producer = 0U; producer < count; ++producer) {
+        _threads.emplace_back(&Producers::run, this, producer);
+    }
+}
+
+template <class Queue>
+void Producers<Queue>::stop() {
+    if (!_stopped.exchange(true)) {
+        startRound();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+}
+
+template <class Queue>
+std::vector<Clock::duration> Producers<Queue>::latencies() const {
+    std::vector<Clock::duration> latencies;
+    for (const auto& producer : _latencies) {
+        latencies.insert(latencies.end(), producer.begin(), producer.end());
+    }
+    return latencies;
+}
+
+template <class Queue>
+void Producers<Queue>::run(size_t producer) {
+    auto& latencies = _latencies[producer];
+    for (uint64_t round = 1U;; ++round) {
+        while (_round.load(std::memory_order_acquire) < round) {
+            std::this_thread::yield();
+        }
+        if (_stopped) {
+            break;
+        }
+        for (size_t i = 0U; i < itemsPerRound; ++i) {
+            const auto sampled = 0U == i % latencySampling;
+            const auto start = sampled ? Clock::now() : Clock::time_point();
+            size_t value = i;
+            while (!_queue.tryPush(std::move(value))) {
+                std::this_thread::yield();
+            }
+            if (sampled) {
+                latencies.push_back(Clock::now() - start);
+            }
+        }
+    }
+}
+
+void reportLatencies(benchmark::State& state, std::vector<Clock::duration> latencies) {
+    if (latencies.empty()) {
+        return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double fraction) {
+        const auto rank = static_cast<size_t>(fraction * static_cast<double>(latencies.size() - 1U) + 0.5);
+        const auto latency = latencies[std::min(rank, latencies.size() - 1U)];
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+    };
+    state.counters["enqueue_p50_ns"] = percentile(0.5);
+    state.counters["enqueue_p99_ns"] = percentile(0.99);
+}
+
+// [range(0)] producers push items while the benchmark thread drains them by batches of 64
+template <class Queue>
+void drain(benchmark::State& state, Queue& queue) {
+    const auto producers = static_cast<size_t>(state.range(0));
+    size_t sum = 0U;
+    Producers<Queue> threads(queue, producers);
+    for (auto _ : state) {
+        threads.startRound();
+        for (size_t received = 0U; received < producers * itemsPerRound;) {
+            const auto count = queue.popBatch([&sum](size_t&& value) { sum += value; }, 64U);
+            if (0U == count) {
+                std::this_thread::yield();
+            }
+            received += count;
+        }
+    }
+    threads.stop();
+    reportLatencies(state, threads.latencies());
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * producers * itemsPerRound));
+}
+
+void mpscRing(benchmark::State& state) {
+    MpscRing<size_t> ring(1024U);
+    drain(state, ring);
+}
+
+void lockedQueue(benchmark::State& state) {
+    LockedQueue queue;
+    drain(state, queue);
+}
+
+} // namespace
+
+BENCHMARK(mpscRing)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK(lockedQueue)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
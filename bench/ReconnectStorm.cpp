@@ -0,0 +1,186 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkResult.h"
+#include "WebsocketReconnect.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+
+// Mass-disconnect model: simulates endpoints dropped at once by a server restart and
+// reconnecting by `ReconnectSchedule` against a modelled server which fails handshakes above
+// its capacity. This is a discrete-event model, not a measurement: no sockets are opened and
+// time is simulated (milliseconds), so runs are fast and reproducible, but the numbers only
+// compare policies against each other. Prints one JSON document (see `toJson`) per policy,
+// the implementation name is prefixed by "model:" and the transport is "unknown",
+// `_elapsed` is the simulated time until all endpoints are connected, latencies are
+// simulated per-endpoint recovery times.
+// Usage: websocket_reconnect_storm [--smoke] [--output <file>]
+
+namespace {
+
+using namespace Websocket;
+
+struct StormConfig
+{
+    size_t _endpoints = 20000U;
+    // concurrent handshakes the restarted server completes, others time out
+    uint32_t _serverCapacity = 500U;
+    // client-side caps of concurrent handshakes (`HandshakeLimiter`), chosen without knowledge
+    // of the server capacity, so that caps above it are modelled too
+    std::vector<uint32_t> _handshakeLimits = {64U, 256U, 1024U};
+    int64_t _handshakeMs = 20;
+    int64_t _handshakeTimeoutMs = 1000;
+    // the simulation gives up after this time
+    int64_t _limitMs = 30 * 60 * 1000;
+};
+
+struct StormStats
+{
+    BenchmarkResult _result;
+    size_t _failedHandshakes = 0U;
+    uint64_t _postponed = 0U;
+    uint32_t _peakHandshakes = 0U;
+};
+
+struct Event
+{
+    int64_t _time = 0;
+    size_t _endPoint = 0U;
+    // the handshake completes, otherwise the attempt is due
+    bool _handshake = false;
+    bool _success = false;
+    bool operator > (const Event& other) const noexcept { return _time > other._time; }
+};
+
+StormStats simulate(const ReconnectPolicy& policy, const StormConfig& config) {
+    std::vector<std::unique_ptr<ReconnectSchedule>> schedules;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+    for (size_t i = 0U; i < config._endpoints; ++i) {
+        schedules.push_back(std::make_unique<ReconnectSchedule>(policy, i + 1U));
+        events.push({schedules.back()->nextDelay().count(), i});
+    }
+    StormStats stats;
+    std::vector<std::chrono::nanoseconds> recovery;
+    uint32_t handshakes = 0U;
+    int64_t now = 0;
+    while (!events.empty() && now < config._limitMs) {
+        const auto event = events.top();
+        events.pop();
+        now = event._time;
+        auto& schedule = *schedules[event._endPoint];
+        if (event._handshake) {
+            --handshakes;
+            if (event._success) {
+                schedule.onSucceeded();
+                recovery.push_back(std::chrono::milliseconds(now));
+            }
+            else {
+                schedule.onFailed();
+                ++stats._failedHandshakes;
+                if (!schedule.exhausted()) {
+                    events.push({now + schedule.nextDelay().count(), event._endPoint});
+                }
+            }
+        }
+        else if (schedule.tryBegin()) {
+            ++handshakes;
+            stats._peakHandshakes = std::max(stats._peakHandshakes, handshakes);
+            const bool success = handshakes <= config._serverCapacity;
+            events.push({now + (success ? config._handshakeMs : config._handshakeTimeoutMs),
+                         event._endPoint, true, success});
+        }
+        else if (!schedule.exhausted()) {
+            // postponed by the handshake limiter
+            events.push({now + schedule.nextDelay().count(), event._endPoint});
+        }
+    }
+    for (const auto& schedule : schedules) {
+        stats._postponed += schedule->postponed();
+    }
+    std::sort(recovery.begin(), recovery.end());
+    const auto percentile = [&recovery](double fraction) {
+        if (recovery.empty()) {
+            return std::chrono::nanoseconds();
+        }
+        return recovery[static_cast<size_t>(fraction * static_cast<double>(recovery.size() - 1U))];
+    };
+    auto& result = stats._result;
+    result._scenario = BenchmarkScenario::ReconnectStorm;
+    // no transport is involved in the model
+    result._transport = Scheme::Unknown;
+    result._operations = recovery.size();
+    result._elapsed = recovery.empty() ? std::chrono::nanoseconds() : recovery.back();
+    result._latencyP50 = percentile(0.5);
+    result._latencyP99 = percentile(0.99);
+    result._latencyP999 = percentile(0.999);
+    return stats;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    StormConfig config;
+    const char* output = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (0 == std::strcmp("--smoke", argv[i])) {
+            config._endpoints = 2000U;
+            config._serverCapacity = 100U;
+        }
+        else if (0 == std::strcmp("--output", argv[i]) && i + 1 < argc) {
+            output = argv[++i];
+        }
+        else {
+            std::cerr << "usage: " << argv[0] << " [--smoke] [--output <file>]" << std::endl;
+            return 2;
+        }
+    }
+    std::ofstream file;
+    if (output) {
+        file.open(output);
+        if (!file) {
+            std::cerr << "failed to open " << output << std::endl;
+            return 2;
+        }
+    }
+    std::ostream& os = output ? file : std::cout;
+    ReconnectPolicy noJitter;
+    noJitter._jitter = false;
+    ReconnectPolicy fullJitter;
+    const auto run = [&](const std::string& name, const ReconnectPolicy& policy) {
+        const auto stats = simulate(policy, config);
+        os << toJson("model:" + name, {stats._result}) << std::endl;
+        std::cerr << "model " << name << ": " << stats._result._operations << '/' << config._endpoints
+                  << " reconnected, failed handshakes " << stats._failedHandshakes
+                  << ", postponed attempts " << stats._postponed
+                  << ", peak handshakes " << stats._peakHandshakes
+                  << " (server capacity " << config._serverCapacity << ')' << std::endl;
+        return stats;
+    };
+    run("ReconnectSchedule/no-jitter", noJitter);
+    run("ReconnectSchedule/full-jitter", fullJitter);
+    bool ok = true;
+    for (const auto limit : config._handshakeLimits) {
+        ReconnectPolicy limited;
+        limited._handshakeLimiter = std::make_shared<HandshakeLimiter>(limit);
+        const auto stats = run("ReconnectSchedule/full-jitter+limiter-" + std::to_string(limit), limited);
+        // the limiter must be honoured regardless of whether the cap fits the server
+        ok = ok && stats._peakHandshakes <= limit;
+    }
+    return ok ? 0 : 1;
+}
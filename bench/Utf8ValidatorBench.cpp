@@ -0,0 +1,95 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketUtf8Validator.h"
+#include <benchmark/benchmark.h>
+#include <string>
+
+namespace {
+
+using namespace Websocket;
+
+std::string repeat(std::string_view sample, size_t size) {
+    std::string text;
+    while (text.size() < size) {
+        text += sample;
+    }
+    return text;
+}
+
+std::string payload(int64_t kind, size_t size) {
+    switch (kind) {
+        case 0:
+            return repeat("{\"id\":12345,\"name\":\"websocket\",\"tags\":[\"a\",\"b\"],\"ok\":true},", size);
+        case 1:
+            return repeat("{\"имя\":\"Привет, мир\",\"名前\":\"こんにちは世界\"},", size);
+        default:
+            return repeat("😀🚀✨ emoji & text ", size);
+    }
+}
+
+const char* label(int64_t kind) {
+    switch (kind) {
+        case 0:
+            return "ascii_json";
+        case 1:
+            return "mixed_json";
+        default:
+            return "emoji";
+    }
+}
+
+void validate(benchmark::State& state) {
+    const auto text = payload(state.range(0), static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Utf8Validator::isValid(text));
+    }
+    state.SetLabel(label(state.range(0)));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+
+template <size_t (*Kernel)(const uint8_t*, size_t, bool&), bool (*Supported)()>
+void validateKernel(benchmark::State& state) {
+    if (!Supported()) {
+        state.SkipWithError("the kernel is not supported by CPU");
+        return;
+    }
+    const auto text = payload(state.range(0), static_cast<size_t>(state.range(1)));
+    const auto data = reinterpret_cast<const uint8_t*>(text.data());
+    for (auto _ : state) {
+        bool valid = false;
+        benchmark::DoNotOptimize(Kernel(data, text.size(), valid));
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetLabel(label(state.range(0)));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_NEON
+bool always() { return true; }
+#endif
+
+} // namespace
+
+BENCHMARK(validate)->ArgsProduct({{0, 1, 2}, {64, 4096, 1 << 20}});
+#ifdef WEBSOCKET_UTF8_VALIDATOR_SSSE3
+BENCHMARK_TEMPLATE(validateKernel, Utf8Details::validateSsse3, Utf8Details::hasSsse3)
+    ->ArgsProduct({{0, 1, 2}, {4096, 1 << 20}});
+#endif
+#ifdef WEBSOCKET_UTF8_VALIDATOR_AVX2
+BENCHMARK_TEMPLATE(validateKernel, Utf8Details::validateAvx2, Utf8Details::hasAvx2)
+    ->ArgsProduct({{0, 1, 2}, {4096, 1 << 20}});
+#endif
+#ifdef WEBSOCKET_UTF8_VALIDATOR_NEON
+BENCHMARK_TEMPLATE(validateKernel, Utf8Details::validateNeon, always)->ArgsProduct({{0, 1, 2}, {4096, 1 << 20}});
+#endif
@@ -0,0 +1,150 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketAcceptor.h
+#include "WebsocketOptions.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Websocket
+{
+
+class EndPoint;
+class Error;
+
+/**
+ * @brief Represents configurable options of the server-side acceptor.
+ */
+struct AcceptorOptions
+{
+    /**
+     * @brief The local address to listen on.
+     *
+     * `inproc://name` registers the acceptor for in-process endpoints of the same factory,
+     * see `Scheme::InProcess`, `ws+unix:///path/to/socket` listens on the Unix domain socket,
+     * see `Scheme::Unix`. `_port` is ignored in both cases.
+     */
+    std::string _address = "0.0.0.0";
+
+    /**
+     * @brief The local port to listen on, 0 means any free port (see `Acceptor::port`).
+     */
+    uint16_t _port = 0U;
+
+    /**
+     * @brief The maximal length of the queue of pending connections (`listen` backlog).
+     */
+    uint32_t _backlog = 4096U;
+
+    /**
+     * @brief The number of listening sockets bound to the same address (SO_REUSEPORT).
+     *
+     * The kernel balances incoming connections across listening sockets, each of them
+     * is served by its own thread, which allows very high accept rates.
+     * Values greater than 1 require SO_REUSEPORT support.
+     */
+    uint32_t _listeners = 1U;
+
+    /**
+     * @brief Options of accepted endpoints.
+     *
+     * Socket options, TLS settings (server certificate & private key), compression,
+     * callbacks delivery and send queue settings are applied to each accepted endpoint,
+     * `Options::_host` is ignored.
+     */
+    Options _endpointOptions;
+};
+
+/**
+ * @brief An interface class for listening to acceptor events.
+ */
+class AcceptorListener
+{
+public:
+    /**
+     * @brief Called when the HTTP upgrade request is received, before the handshake response.
+     *
+     * Allows routing or authorization of incoming connections.
+     *
+     * @param resource The requested resource, e.g. `/stream?token=...`.
+     * @param headers The headers of the upgrade request.
+     * @return `true` to accept the connection, `false` to reject it with HTTP 403.
+     */
+    virtual bool onUpgradeRequest(std::string_view /*resource*/,
+                                  const std::unordered_map<std::string, std::string>& /*headers*/) {
+        return true;
+    }
+
+    /**
+     * @brief Called when the handshake with a new client is completed.
+     *
+     * The endpoint is in `State::Connected` state, incoming messages are not delivered until
+     * the listener is set by `EndPoint::setListener`. Calls of `EndPoint::open` fail for accepted endpoints.
+     *
+     * @param endPoint The accepted endpoint, ownership is passed to the listener.
+     * @param connectionId The unique identifier of the connection, passed to all `Listener` callbacks.
+     */
+    virtual void onAccepted(std::unique_ptr<EndPoint> endPoint, uint64_t connectionId) = 0;
+
+    /**
+     * @brief Called when accepting or the handshake fails.
+     *
+     * @param error Details of the error that occurred.
+     */
+    virtual void onError(const Error& /*error*/) {}
+
+protected:
+    virtual ~AcceptorListener() = default;
+};
+
+/**
+ * @brief Abstract server-side acceptor of websocket connections.
+ *
+ * The `Acceptor` class listens for incoming connections, performs the HTTP upgrade
+ * and produces `EndPoint` objects that report events through the same `Listener` callbacks
+ * as client endpoints.
+ */
+class Acceptor
+{
+public:
+    /**
+     * @brief Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~Acceptor() = default;
+
+    /**
+     * @brief Starts listening for incoming connections.
+     *
+     * @param options The configuration options of the acceptor.
+     * @param listener The receiver of accepted endpoints.
+     * @return `true` if listening sockets were bound successfully, otherwise `false`.
+     */
+    virtual bool start(AcceptorOptions options, const std::shared_ptr<AcceptorListener>& listener) = 0;
+
+    /**
+     * @brief Stops listening, already accepted endpoints are not affected.
+     */
+    virtual void stop() = 0;
+
+    /**
+     * @brief Retrieves the local port of listening sockets.
+     *
+     * @return The bound port, 0 if the acceptor is not started.
+     */
+    virtual uint16_t port() const = 0;
+};
+
+} // namespace Websocket
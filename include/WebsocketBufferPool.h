@@ -0,0 +1,281 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketBufferPool.h
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace Websocket
+{
+
+/**
+ * @brief Represents a snapshot of the buffer pool statistics.
+ */
+struct BufferPoolStats
+{
+    /**
+     * @brief The number of buffers served from the pool.
+     */
+    uint64_t _hits = 0U;
+
+    /**
+     * @brief The number of buffers allocated from the heap.
+     */
+    uint64_t _misses = 0U;
+
+    /**
+     * @brief The number of buffers kept by the pool for reuse.
+     */
+    uint64_t _buffersRetained = 0U;
+
+    /**
+     * @brief The total capacity (in bytes) of buffers kept by the pool for reuse.
+     */
+    uint64_t _bytesRetained = 0U;
+
+    /**
+     * @brief Calculates the ratio of buffers served from the pool.
+     *
+     * @return The hit rate in range [0, 1].
+     */
+    double hitRate() const noexcept {
+        const auto total = _hits + _misses;
+        return total ? static_cast<double>(_hits) / static_cast<double>(total) : 0.;
+    }
+};
+
+/**
+ * @brief Size-classed pool of receive and send frame buffers, shared between endpoints.
+ *
+ * Capacities are rounded up to powers of two from `MinBufferSize` to `MaxBufferSize`,
+ * larger buffers bypass the pool. Free lists are striped by thread, so threads
+ * acquiring and releasing buffers rarely contend, a thread whose stripe is empty
+ * takes a buffer of the same size class from other stripes before allocating, stripes
+ * without such buffers are skipped without locking. Endpoints acquire a buffer per frame
+ * and release it once the listener callback returns (or the shared blob is destroyed)
+ * or the send completes. All methods are thread-safe, methods are virtual
+ * to allow custom allocators.
+ */
+class BufferPool
+{
+    static constexpr size_t MinSizeBits = 6U;
+    static constexpr size_t MaxSizeBits = 20U;
+    static constexpr size_t Classes = MaxSizeBits - MinSizeBits + 1U;
+    static constexpr size_t Stripes = 8U;
+    static_assert(Classes <= 32U, "size classes must fit into the bitmask of available buffers");
+
+public:
+    /**
+     * @brief The capacity of the smallest size class.
+     */
+    static constexpr size_t MinBufferSize = size_t(1) << MinSizeBits;
+
+    /**
+     * @brief The capacity of the largest size class.
+     */
+    static constexpr size_t MaxBufferSize = size_t(1) << MaxSizeBits;
+
+    /**
+     * @brief Represents a buffer acquired from the pool.
+     */
+    struct Buffer
+    {
+        /**
+         * @brief Pointer to the buffer memory, `nullptr` for empty buffers.
+         */
+        uint8_t* _data = nullptr;
+
+        /**
+         * @brief The capacity of the buffer, at least the requested size.
+         */
+        size_t _capacity = 0U;
+    };
+
+    /**
+     * @brief Constructs the pool.
+     *
+     * @param maxBytesRetained Maximal total capacity of buffers kept for reuse,
+     *                         released buffers above this limit are freed.
+     */
+    explicit BufferPool(uint64_t maxBytesRetained = uint64_t(64) << 20U) : _maxBytesRetained(maxBytesRetained) {}
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator = (const BufferPool&) = delete;
+
+    /**
+     * @brief Virtual destructor, frees retained buffers.
+     *
+     * Buffers acquired from the pool must be released before its destruction.
+     */
+    virtual ~BufferPool();
+
+    /**
+     * @brief Acquires a buffer.
+     *
+     * @param size The required size (in bytes).
+     * @return The buffer, its memory is not initialized.
+     */
+    virtual Buffer acquire(size_t size);
+
+    /**
+     * @brief Returns the buffer to the pool.
+     *
+     * @param buffer The buffer obtained by `acquire`, may be released by any thread.
+     */
+    virtual void release(Buffer buffer) noexcept;
+
+    /**
+     * @brief Retrieves the pool statistics.
+     *
+     * @return A snapshot of hits, misses and retained buffers.
+     */
+    virtual BufferPoolStats stats() const noexcept;
+
+private:
+    struct Stripe
+    {
+        std::mutex _mutex;
+        std::array<std::vector<uint8_t*>, Classes> _free;
+        // bit per size class with free buffers, read without the lock to skip empty stripes
+        std::atomic<uint32_t> _available = 0U;
+    };
+
+    static size_t classOf(size_t size) noexcept;
+    static size_t stripeIndex() noexcept;
+    // pops a free buffer of the size class, `nullptr` if there is none,
+    // the stripe is not locked if it has no free buffers of the class
+    static uint8_t* take(Stripe& stripe, size_t index);
+
+private:
+    const uint64_t _maxBytesRetained;
+    std::array<Stripe, Stripes> _stripes;
+    std::atomic<uint64_t> _hits = 0U;
+    std::atomic<uint64_t> _misses = 0U;
+    std::atomic<uint64_t> _buffersRetained = 0U;
+    std::atomic<uint64_t> _bytesRetained = 0U;
+};
+
+inline BufferPool::~BufferPool() {
+    for (auto& stripe : _stripes) {
+        for (auto& buffers : stripe._free) {
+            for (auto data : buffers) {
+                ::operator delete(data);
+            }
+        }
+    }
+}
+
+inline BufferPool::Buffer BufferPool::acquire(size_t size) {
+    Buffer buffer;
+    if (size) {
+        const auto index = classOf(size);
+        if (index < Classes) {
+            buffer._capacity = MinBufferSize << index;
+            const auto home = stripeIndex();
+            buffer._data = take(_stripes[home], index);
+            // buffers released by other threads (e.g. a reader acquires, a worker releases)
+            // are stolen from their stripes, so that such pipelines don't miss forever,
+            // stripes without buffers of the class are skipped without locking
+            for (size_t i = 1U; !buffer._data && i < Stripes; ++i) {
+                buffer._data = take(_stripes[(home + i) % Stripes], index);
+            }
+            if (buffer._data) {
+                _buffersRetained.fetch_sub(1U, std::memory_order_relaxed);
+                _bytesRetained.fetch_sub(buffer._capacity, std::memory_order_relaxed);
+                _hits.fetch_add(1U, std::memory_order_relaxed);
+                return buffer;
+            }
+        }
+        else {
+            buffer._capacity = size;
+        }
+        buffer._data = static_cast<uint8_t*>(::operator new(buffer._capacity));
+        _misses.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return buffer;
+}
+
+inline void BufferPool::release(Buffer buffer) noexcept {
+    if (buffer._data) {
+        const auto index = classOf(buffer._capacity);
+        if (index < Classes && buffer._capacity == (MinBufferSize << index)) {
+            const auto retained = _bytesRetained.fetch_add(buffer._capacity, std::memory_order_relaxed);
+            if (retained + buffer._capacity <= _maxBytesRetained) {
+                auto& stripe = _stripes[stripeIndex()];
+                try {
+                    const std::lock_guard<std::mutex> lock(stripe._mutex);
+                    auto& buffers = stripe._free[index];
+                    buffers.push_back(buffer._data);
+                    if (1U == buffers.size()) {
+                        stripe._available.fetch_or(uint32_t(1) << index, std::memory_order_relaxed);
+                    }
+                    _buffersRetained.fetch_add(1U, std::memory_order_relaxed);
+                    return;
+                }
+                catch (...) {
+                    // out of memory for the free list, fall through and free the buffer
+                }
+            }
+            _bytesRetained.fetch_sub(buffer._capacity, std::memory_order_relaxed);
+        }
+        ::operator delete(buffer._data);
+    }
+}
+
+inline BufferPoolStats BufferPool::stats() const noexcept {
+    BufferPoolStats stats;
+    stats._hits = _hits.load(std::memory_order_relaxed);
+    stats._misses = _misses.load(std::memory_order_relaxed);
+    stats._buffersRetained = _buffersRetained.load(std::memory_order_relaxed);
+    stats._bytesRetained = _bytesRetained.load(std::memory_order_relaxed);
+    return stats;
+}
+
+inline size_t BufferPool::classOf(size_t size) noexcept {
+    size_t index = 0U;
+    while (index < Classes && (MinBufferSize << index) < size) {
+        ++index;
+    }
+    return index;
+}
+
+inline size_t BufferPool::stripeIndex() noexcept {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) % Stripes;
+}
+
+inline uint8_t* BufferPool::take(Stripe& stripe, size_t index) {
+    const auto bit = uint32_t(1) << index;
+    if (0U == (stripe._available.load(std::memory_order_relaxed) & bit)) {
+        return nullptr;
+    }
+    const std::lock_guard<std::mutex> lock(stripe._mutex);
+    auto& buffers = stripe._free[index];
+    if (buffers.empty()) {
+        return nullptr;
+    }
+    const auto data = buffers.back();
+    buffers.pop_back();
+    if (buffers.empty()) {
+        stripe._available.fetch_and(~bit, std::memory_order_relaxed);
+    }
+    return data;
+}
+
+} // namespace Websocket
@@ -0,0 +1,130 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketCompression.h
+#include <cstdint>
+#include <string>
+
+namespace Websocket
+{
+
+/**
+ * @brief Represents the configuration for permessage-deflate compression.
+ *
+ * The `Compression` struct provides parameters of the permessage-deflate extension
+ * negotiated during the handshake, see RFC 7692 for details.
+ * @see https://datatracker.ietf.org/doc/html/rfc7692
+ */
+struct Compression
+{
+    /**
+     * @brief The minimal LZ77 window size (base-2 logarithm) allowed by RFC 7692.
+     */
+    static constexpr uint8_t MinWindowBits = 8U;
+
+    /**
+     * @brief The maximal LZ77 window size (base-2 logarithm) allowed by RFC 7692, the default.
+     */
+    static constexpr uint8_t MaxWindowBits = 15U;
+
+    /**
+     * @brief The base-2 logarithm of the LZ77 sliding window size used by the server.
+     *
+     * Valid values are in range [`MinWindowBits`, `MaxWindowBits`] = [8, 15], smaller windows
+     * reduce memory usage at the cost of compression ratio. Out-of-range values are clamped
+     * to the nearest bound by `extensionOffer`.
+     */
+    uint8_t _serverMaxWindowBits = MaxWindowBits;
+
+    /**
+     * @brief The base-2 logarithm of the LZ77 sliding window size used by the client.
+     *
+     * Valid values are in range [`MinWindowBits`, `MaxWindowBits`] = [8, 15], smaller windows
+     * reduce memory usage at the cost of compression ratio. Out-of-range values are clamped
+     * to the nearest bound by `extensionOffer`.
+     */
+    uint8_t _clientMaxWindowBits = MaxWindowBits;
+
+    /**
+     * @brief Disable context takeover on the server side.
+     *
+     * If true, the server resets its compression context after each message.
+     */
+    bool _serverNoContextTakeover = false;
+
+    /**
+     * @brief Disable context takeover on the client side.
+     *
+     * If true, the client resets its compression context after each message.
+     */
+    bool _clientNoContextTakeover = false;
+
+    /**
+     * @brief Minimal size (in bytes) of the message payload to be compressed.
+     *
+     * Messages smaller than this threshold are sent uncompressed,
+     * because compression of tiny payloads costs more CPU than it saves bandwidth.
+     */
+    uint32_t _threshold = 1024U;
+
+    /**
+     * @brief The deflate compression level.
+     *
+     * Valid values are in range [0, 9], where 0 means no compression,
+     * 1 - best speed and 9 - best compression.
+     */
+    uint8_t _level = 6U;
+};
+
+/**
+ * @brief Clamps the window size (base-2 logarithm) to the range allowed by RFC 7692.
+ *
+ * @param bits The requested window bits.
+ * @return The value clamped to [`Compression::MinWindowBits`, `Compression::MaxWindowBits`].
+ */
+constexpr uint8_t clampWindowBits(uint8_t bits) noexcept {
+    return bits < Compression::MinWindowBits ? Compression::MinWindowBits :
+          (bits > Compression::MaxWindowBits ? Compression::MaxWindowBits : bits);
+}
+
+/**
+ * @brief Builds the value of the `Sec-WebSocket-Extensions` header for the compression offer.
+ *
+ * Only parameters that differ from the RFC 7692 defaults are included into the offer,
+ * window bits are clamped to the valid range by `clampWindowBits`, so the offer
+ * is never rejected by a compliant peer because of malformed parameters.
+ *
+ * @param compression The compression settings.
+ * @return A `std::string` with the extension offer, e.g. `permessage-deflate; client_max_window_bits`.
+ */
+inline std::string extensionOffer(const Compression& compression) {
+    std::string offer = "permessage-deflate";
+    if (compression._serverNoContextTakeover) {
+        offer += "; server_no_context_takeover";
+    }
+    if (compression._clientNoContextTakeover) {
+        offer += "; client_no_context_takeover";
+    }
+    const auto serverMaxWindowBits = clampWindowBits(compression._serverMaxWindowBits);
+    if (serverMaxWindowBits < Compression::MaxWindowBits) {
+        offer += "; server_max_window_bits=" + std::to_string(serverMaxWindowBits);
+    }
+    offer += "; client_max_window_bits";
+    const auto clientMaxWindowBits = clampWindowBits(compression._clientMaxWindowBits);
+    if (clientMaxWindowBits < Compression::MaxWindowBits) {
+        offer += "=" + std::to_string(clientMaxWindowBits);
+    }
+    return offer;
+}
+
+} // namespace Websocket
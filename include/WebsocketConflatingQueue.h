@@ -0,0 +1,171 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketConflatingQueue.h
+#include "WebsocketSendOptions.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace Websocket
+{
+
+/**
+ * @brief Queue of outgoing messages implementing modes of `SendQueue`.
+ *
+ * The `ConflatingQueue` class is a building block of the send path of endpoints:
+ * in `SendQueue::Conflating` mode messages are popped by `SendPriority`, and a message
+ * with a conflation key replaces the queued message with the same key, taking its place
+ * in the queue if the priority is the same. In `SendQueue::Fifo` mode `SendOptions`
+ * are ignored. Replaced messages leave empty slots that are skipped by `pop`,
+ * so both operations take amortized constant time.
+ * The class is not thread-safe, endpoints guard it together with their write state.
+ *
+ * @tparam T Type of messages, must be move constructible.
+ */
+template <typename T>
+class ConflatingQueue
+{
+public:
+    /**
+     * @brief Constructs the empty queue.
+     *
+     * @param mode The mode of the queue, see `Options::_sendQueue`.
+     */
+    explicit ConflatingQueue(SendQueue mode = SendQueue::Conflating) noexcept : _mode(mode) {}
+
+    /**
+     * @brief Enqueues the message.
+     *
+     * @param message The message to enqueue.
+     * @param options Priority and conflation key of the message.
+     * @return `true` if a queued message with the same conflation key was replaced.
+     */
+    bool push(T message, const SendOptions& options = {});
+
+    /**
+     * @brief Dequeues the oldest message of the highest priority.
+     *
+     * @param message The receiver of the dequeued message.
+     * @return `false` if the queue is empty.
+     */
+    bool pop(T& message);
+
+    /**
+     * @brief Retrieves the number of queued messages, replaced ones are not counted.
+     */
+    size_t size() const noexcept { return _size; }
+
+    /**
+     * @brief Checks whether the queue has no messages.
+     */
+    bool empty() const noexcept { return 0U == _size; }
+
+    /**
+     * @brief Retrieves the total number of messages replaced by newer ones.
+     */
+    uint64_t conflated() const noexcept { return _conflated; }
+
+    /**
+     * @brief Retrieves the mode of the queue.
+     */
+    SendQueue mode() const noexcept { return _mode; }
+
+private:
+    struct Slot
+    {
+        std::optional<T> _message;
+        std::optional<uint64_t> _key;
+    };
+    struct Level
+    {
+        std::deque<Slot> _slots;
+        // sequence number of the front slot
+        uint64_t _front = 0U;
+    };
+    struct Position
+    {
+        size_t _level = 0U;
+        uint64_t _sequence = 0U;
+    };
+
+private:
+    const SendQueue _mode;
+    // indexed by `SendPriority`
+    std::array<Level, 3U> _levels;
+    std::unordered_map<uint64_t, Position> _keys;
+    size_t _size = 0U;
+    uint64_t _conflated = 0U;
+};
+
+template <typename T>
+inline bool ConflatingQueue<T>::push(T message, const SendOptions& options) {
+    size_t level = static_cast<size_t>(SendPriority::Normal);
+    std::optional<uint64_t> key;
+    if (SendQueue::Conflating == _mode) {
+        level = static_cast<size_t>(options._priority);
+        key = options._conflationKey;
+    }
+    bool replaced = false;
+    if (key) {
+        const auto it = _keys.find(*key);
+        if (it != _keys.end()) {
+            auto& queued = _levels[it->second._level];
+            auto& slot = queued._slots[static_cast<size_t>(it->second._sequence - queued._front)];
+            ++_conflated;
+            if (it->second._level == level) {
+                slot._message.emplace(std::move(message));
+                return true;
+            }
+            // the message moves to the tail of another priority
+            slot._message.reset();
+            --_size;
+            _keys.erase(it);
+            replaced = true;
+        }
+    }
+    auto& target = _levels[level];
+    target._slots.push_back({std::move(message), key});
+    if (key) {
+        _keys[*key] = {level, target._front + target._slots.size() - 1U};
+    }
+    ++_size;
+    return replaced;
+}
+
+template <typename T>
+inline bool ConflatingQueue<T>::pop(T& message) {
+    for (size_t level = _levels.size(); _size && level > 0U; --level) {
+        auto& queued = _levels[level - 1U];
+        while (!queued._slots.empty()) {
+            auto slot = std::move(queued._slots.front());
+            queued._slots.pop_front();
+            ++queued._front;
+            if (slot._message) {
+                if (slot._key) {
+                    _keys.erase(*slot._key);
+                }
+                message = std::move(*slot._message);
+                --_size;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace Websocket
@@ -15,6 +15,9 @@
 #include "WebsocketState.h"
 #include "WebsocketCloseCode.h"
 #include "WebsocketOptions.h"
+#include "WebsocketMessageView.h"
+#include "WebsocketSendOptions.h"
+#include "WebsocketStats.h"
 #include <memory>
 #include <string>
 
@@ -28,6 +31,7 @@ namespace Websocket
 {
 
 class Listener;
+class PreparedMessage;
 enum class State;
 
 /**
@@ -35,6 +39,9 @@ enum class State;
  *
  * The `EndPoint` class provides an interface for managing websocket connections,
  * including opening and closing connections, sending messages, and tracking connection states.
+ * Send methods may be called concurrently from any thread, implementations should not serialize
+ * producers on a mutex but enqueue messages into a lock-free queue (such as `MpscRing`)
+ * drained by the I/O thread.
  */
 class EndPoint
 {
@@ -67,7 +74,8 @@ public:
     /**
      * @brief Closes the websocket connection.
      *
-     * Gracefully shuts down the connection and notifies the listener of state changes.
+     * Gracefully shuts down the connection and notifies the listener of state changes,
+     * cancels pending automatic reconnection (see `Options::_reconnect`).
      */
     virtual void close() = 0;
 
@@ -101,10 +109,141 @@ public:
      */
     virtual bool sendText(std::string_view text) = 0;
 
+    /**
+     * @brief Sends a binary message, transfers ownership of the buffer to the endpoint.
+     *
+     * Counterpart of `Listener::onSharedBinaryMessage`: the endpoint may keep the buffer
+     * until it is written, and `Scheme::InProcess` endpoints hand it over to the peer
+     * listener without copying. The default implementation calls `sendBinary`.
+     *
+     * @param binary The binary message to send, immutable and may be shared with other consumers.
+     * @return `true` if the message was successfully sent, otherwise `false`.
+     */
+    virtual bool sendSharedBinary(std::shared_ptr<const Bricks::Blob> binary) {
+        return binary && sendBinary(*binary);
+    }
+
+    /**
+     * @brief Queues a binary message with priority and conflation options.
+     *
+     * Options take effect if `Options::_sendQueue` is `SendQueue::Conflating`,
+     * otherwise the call is equivalent to `sendBinary`.
+     * The default implementation ignores options and calls `sendBinary`.
+     *
+     * @param binary The binary message to send as a `Bricks::Blob`.
+     * @param options The priority and conflation key of the message.
+     * @return `true` if the message was successfully queued, otherwise `false`.
+     */
+    virtual bool queueBinary(const Bricks::Blob& binary, const SendOptions& /*options*/) {
+        return sendBinary(binary);
+    }
+
+    /**
+     * @brief Queues a text message with priority and conflation options.
+     *
+     * Semantic is the same as for `queueBinary`.
+     * The default implementation ignores options and calls `sendText`.
+     *
+     * @param text The text message to send as a `std::string_view`.
+     * @param options The priority and conflation key of the message.
+     * @return `true` if the message was successfully queued, otherwise `false`.
+     */
+    virtual bool queueText(std::string_view text, const SendOptions& /*options*/) {
+        return sendText(text);
+    }
+
+    /**
+     * @brief Sends a part of a fragmented binary message over the websocket connection.
+     *
+     * The first call starts a new message, subsequent calls send continuation frames
+     * until [last] is `true`. Other data messages must not be sent until the fragmented
+     * message is completed, control frames (such as pings) may be interleaved.
+     * The default implementation doesn't support fragmentation and returns `false`.
+     *
+     * @param fragment The part of the message to send.
+     * @param last `true` if this is the final fragment of the message.
+     * @return `true` if the fragment was successfully sent, otherwise `false`.
+     */
+    virtual bool sendBinaryFragment(const Bricks::Blob& /*fragment*/, bool /*last*/) { return false; }
+
+    /**
+     * @brief Sends a part of a fragmented text message over the websocket connection.
+     *
+     * Semantic is the same as for `sendBinaryFragment`, the fragment boundaries
+     * may split multi-byte UTF-8 sequences.
+     *
+     * @param fragment The part of the message to send.
+     * @param last `true` if this is the final fragment of the message.
+     * @return `true` if the fragment was successfully sent, otherwise `false`.
+     */
+    virtual bool sendTextFragment(std::string_view /*fragment*/, bool /*last*/) { return false; }
+
+    /**
+     * @brief Sends a batch of text and/or binary messages over the websocket connection.
+     *
+     * Messages are sent in the given order. Implementations are expected to frame
+     * all messages in one pass and flush them with a single vectored write
+     * (`writev`/`sendmsg`) instead of paying a lock and a syscall per message.
+     * The default implementation falls back to sequential `sendText`/`sendBinary` calls,
+     * `sendSharedBinary` for views with a shared payload.
+     *
+     * @param messages Pointer to the first message of the batch.
+     * @param count The number of messages in the batch.
+     * @return The number of leading messages that were successfully sent,
+     *         equals to [count] if the whole batch was sent.
+     */
+    virtual size_t sendBatch(const MessageView* messages, size_t count) {
+        size_t sent = 0U;
+        for (; sent < count; ++sent) {
+            const auto& message = messages[sent];
+            const auto ok = message._sharedBinary ? sendSharedBinary(message._sharedBinary) :
+                            message.binary() ? sendBinary(*message._binary) : sendText(message._text);
+            if (!ok) {
+                break;
+            }
+        }
+        return sent;
+    }
+
+    /**
+     * @brief Queues the prepared message over the websocket connection.
+     *
+     * The endpoint keeps a reference to the shared frame until it is written,
+     * the payload is neither re-encoded nor copied (except masking on the client side).
+     * The default implementation doesn't support prepared messages and returns `false`.
+     *
+     * @param message The message encoded by `PreparedMessage::create`.
+     * @return `true` if the message was successfully queued, otherwise `false`.
+     */
+    virtual bool sendPrepared(const std::shared_ptr<const PreparedMessage>& /*message*/) { return false; }
+
+    /**
+     * @brief Retrieves the amount of outgoing data queued but not yet written to the socket.
+     *
+     * If `Options::_bufferedHighWatermark` is set, send methods fail once this amount
+     * reaches the high watermark, `Listener::onWritable` is called when the queue drains
+     * below `Options::_bufferedLowWatermark`.
+     * The default implementation doesn't track queued data and returns 0.
+     *
+     * @return The number of queued bytes, including frame headers.
+     */
+    virtual uint64_t bufferedAmount() const { return 0U; }
+
+    /**
+     * @brief Retrieves performance statistics of the endpoint.
+     *
+     * Implementations are expected to collect them by `StatsCounters`, so that
+     * the hot path is not affected. The default implementation returns empty statistics.
+     *
+     * @return A snapshot of the endpoint statistics.
+     */
+    virtual Stats stats() const { return {}; }
+
     /**
      * @brief Sends a ping message with a payload over the websocket connection.
      *
      * The server is expected to respond with a pong message containing the same payload.
+     * Control frames bypass the send queue and are written ahead of queued data messages.
      *
      * @param payload The ping message payload as a `Bricks::Blob`.
      * @return `true` if the ping was successfully sent, otherwise `false`.
@@ -114,6 +253,8 @@ public:
     /**
      * @brief Sends a ping message without a payload over the websocket connection.
      *
+     * Control frames bypass the send queue and are written ahead of queued data messages.
+     *
      * @return `true` if the ping was successfully sent, otherwise `false`.
      */
     virtual bool ping() = 0;
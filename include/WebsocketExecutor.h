@@ -0,0 +1,84 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketExecutor.h
+#include <functional>
+
+namespace Websocket
+{
+
+/**
+ * @brief An interface class for user-provided executors of `Listener` callbacks.
+ *
+ * Implementations may run tasks on a thread pool, an event loop of the application, etc.
+ * Posted tasks must own their arguments: endpoint implementations copy payloads passed
+ * to `Listener` as `const Bricks::Blob&` or `std::string_view` before posting, because
+ * these arguments reference I/O buffers that are reused once the read completes.
+ * Shared payloads (`onSharedBinaryMessage`, `MessageView::_sharedBinary` of batches) are posted
+ * by reference count, without copying.
+ */
+class Executor
+{
+public:
+    /**
+     * @brief Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~Executor() = default;
+
+    /**
+     * @brief Schedules the task for execution, must not block and must not run the task inline.
+     *
+     * @param task The task to execute.
+     */
+    virtual void post(std::function<void()> task) = 0;
+};
+
+/**
+ * @brief Enum class representing policies of `Listener` callbacks delivery.
+ *
+ * For all policies callbacks of a single connection are dispatched (invoked or posted)
+ * in the order of events: state changes, errors and messages. Whether they also run
+ * in that order depends on the policy: `Inline` and `Strand` guarantee it,
+ * `Executor` guarantees it only for serial executors.
+ */
+enum class CallbackDelivery
+{
+    /**
+     * @brief Callbacks are invoked directly on the I/O thread.
+     *
+     * All callbacks of a connection are invoked on the same thread for the whole lifetime
+     * of the connection and never concurrently. No queue hop or context switch is involved,
+     * listeners must not block.
+     */
+    Inline,
+
+    /**
+     * @brief Callbacks are posted to the user-provided `Executor`.
+     *
+     * Callbacks of a connection are posted in order, the order of execution and absence
+     * of concurrent calls are guaranteed only if the executor itself is serial, for example
+     * a single-threaded event loop. Use `Strand` with multi-threaded executors.
+     */
+    Executor,
+
+    /**
+     * @brief Callbacks are posted to the user-provided `Executor` through a per-connection strand.
+     *
+     * Callbacks of a connection are executed in order and never concurrently,
+     * but possibly on different threads of the executor. Callbacks of different
+     * connections may run in parallel.
+     */
+    Strand
+};
+
+} // namespace Websocket
@@ -12,7 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once
+#include "WebsocketAcceptor.h"
+#include "WebsocketGenericPool.h"
+#include "WebsocketIoBackend.h"
+#include "WebsocketPool.h"
+#include "WebsocketScheme.h"
+#include "WebsocketSharding.h"
+#include "WebsocketStats.h"
 #include <memory>
+#include <vector>
 
 namespace Websocket
 {
@@ -40,6 +48,88 @@ public:
      * @return A `std::unique_ptr` to the newly created `EndPoint` instance.
      */
     virtual std::unique_ptr<EndPoint> create() const = 0;
+
+    /**
+     * @brief Creates a server-side acceptor of websocket connections.
+     *
+     * The default implementation supports client endpoints only and returns `nullptr`.
+     *
+     * @return A `std::unique_ptr` to the newly created `Acceptor` instance or `nullptr`.
+     */
+    virtual std::unique_ptr<Acceptor> createAcceptor() const { return nullptr; }
+
+    /**
+     * @brief Checks whether endpoints of this factory support the I/O backend.
+     *
+     * Allows selecting of `ShardingOptions::_ioBackend` at runtime, for example falling back
+     * to `IoBackend::Epoll` on kernels without io_uring.
+     *
+     * @param backend The I/O backend to check.
+     * @return `true` if the backend is supported, only `IoBackend::Default` by default.
+     */
+    virtual bool supports(IoBackend backend) const { return IoBackend::Default == backend; }
+
+    /**
+     * @brief Checks whether endpoints and acceptors of this factory support the transport.
+     *
+     * Endpoints fail to open `Options::_host` with an unsupported scheme.
+     * `Scheme::Unknown` stands for hosts without a scheme (e.g. `example.com:8080`),
+     * which endpoints keep resolving as they did before schemes were introduced.
+     *
+     * For `Scheme::Unix` and `Scheme::SecureUnix` the transport is available on POSIX systems only.
+     *
+     * @param scheme The transport scheme to check, see `schemeOf`.
+     * @return `true` if the scheme is supported, `Scheme::Unknown`, `Scheme::Ws` and `Scheme::Wss` by default.
+     */
+    virtual bool supportsScheme(Scheme scheme) const {
+        return Scheme::Unknown == scheme || Scheme::Ws == scheme || Scheme::Wss == scheme;
+    }
+
+    /**
+     * @brief Retrieves aggregate statistics of all endpoints created by this factory.
+     *
+     * Includes endpoints that are already destroyed, so counters never decrease.
+     * The default implementation returns empty statistics.
+     *
+     * @return A snapshot of the aggregate statistics, see `toPrometheus` for export.
+     */
+    virtual Stats stats() const { return {}; }
+
+    /**
+     * @brief Configures event-loop shards driving endpoints and acceptors of this factory.
+     *
+     * Must be called before the first endpoint or acceptor is created, the configuration
+     * can't be changed while shards are running. The default implementation has no sharded
+     * event loops and rejects any configuration.
+     *
+     * @param options The configuration of event-loop shards.
+     * @return `true` if the configuration is applied, `false` if sharding is not supported,
+     *         the options are invalid or shards are already running.
+     */
+    virtual bool setSharding(const ShardingOptions& /*options*/) { return false; }
+
+    /**
+     * @brief Retrieves the load of event-loop shards, see `ShardingOptions`.
+     *
+     * The default implementation has no sharded event loops and returns an empty list.
+     *
+     * @return A snapshot of load for each shard, indexed by shard.
+     */
+    virtual std::vector<ShardLoad> shardsLoad() const { return {}; }
+
+    /**
+     * @brief Creates a pool of pre-warmed endpoints.
+     *
+     * The default implementation returns a `GenericPool` of endpoints created by `create`,
+     * implementations may override it to share connection setup (DNS, TLS sessions) between
+     * pooled endpoints. The factory must outlive the pool.
+     *
+     * @param options The configuration options of the pool.
+     * @return A `std::unique_ptr` to the newly created `Pool` instance or `nullptr`.
+     */
+    virtual std::unique_ptr<Pool> createPool(PoolOptions options) const {
+        return std::make_unique<GenericPool>([this]() { return create(); }, std::move(options));
+    }
 };
 
 } // namespace Websocket
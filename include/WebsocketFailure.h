@@ -78,7 +78,36 @@ enum class Failure
      *
      * Represents a failure in a ping-related operation.
      */
-    Ping
+    Ping,
+
+    /**
+     * @brief Failure in message compression or decompression.
+     *
+     * Indicates that the permessage-deflate negotiation or (de)compression of a message failed.
+     */
+    Compression,
+
+    /**
+     * @brief Failure due to invalid text payload.
+     *
+     * Indicates that a received text message is not valid UTF-8,
+     * the connection is closed with `CloseCode::InvalidPayload`.
+     */
+    InvalidText,
+
+    /**
+     * @brief Failure of the I/O backend.
+     *
+     * Indicates that the requested I/O backend is not available or failed to initialize.
+     */
+    IoBackend,
+
+    /**
+     * @brief Failure due to a timeout.
+     *
+     * Indicates that the peer didn't respond within `Options::_idleTimeout`.
+     */
+    Timeout
 };
 
 /**
@@ -108,6 +137,14 @@ inline const char* toString(Failure failure) {
             return "TLS options";
         case Failure::Ping:
             return "ping";
+        case Failure::Compression:
+            return "compression";
+        case Failure::InvalidText:
+            return "invalid text";
+        case Failure::IoBackend:
+            return "I/O backend";
+        case Failure::Timeout:
+            return "timeout";
         default:
             break;
     }
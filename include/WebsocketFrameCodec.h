@@ -0,0 +1,275 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketFrameCodec.h
+#include "WebsocketOpcode.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WEBSOCKET_FRAME_CODEC_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define WEBSOCKET_FRAME_CODEC_AVX2
+#include <immintrin.h>
+#elif defined(WEBSOCKET_FRAME_CODEC_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+      (defined(__x86_64__) || defined(__i386__))
+// AVX2 kernel is compiled for the target attribute and selected at runtime
+#define WEBSOCKET_FRAME_CODEC_AVX2
+#define WEBSOCKET_FRAME_CODEC_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define WEBSOCKET_FRAME_CODEC_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Websocket
+{
+
+/**
+ * @brief Namespace containing low-level routines for encoding of websocket frames.
+ *
+ * All routines work on caller-provided memory and never allocate.
+ * For details about frame layout, refer to RFC 6455, section 5.2.
+ */
+namespace FrameCodec
+{
+    /**
+     * @brief Type alias for the 4-byte masking key, in the wire order.
+     */
+    using MaskKey = std::array<uint8_t, 4U>;
+
+    /**
+     * @brief Maximal size (in bytes) of the frame header, including the masking key.
+     */
+    static constexpr size_t MaxHeaderSize = 14U;
+
+    /**
+     * @brief Maximal size (in bytes) of the control frame payload.
+     */
+    static constexpr size_t MaxControlPayloadSize = 125U;
+
+    namespace Details
+    {
+        inline void fillPattern(uint8_t* pattern, size_t size, const MaskKey& key, size_t offset) noexcept {
+            for (size_t i = 0U; i < size; ++i) {
+                pattern[i] = key[(offset + i) & 3U];
+            }
+        }
+
+        inline void maskScalar(uint8_t* data, size_t size, const MaskKey& key, size_t offset) noexcept {
+            uint8_t pattern[8];
+            fillPattern(pattern, sizeof(pattern), key, offset);
+            uint64_t pattern64;
+            std::memcpy(&pattern64, pattern, sizeof(pattern64));
+            size_t i = 0U;
+            for (; i + 8U <= size; i += 8U) {
+                uint64_t value;
+                std::memcpy(&value, data + i, sizeof(value));
+                value ^= pattern64;
+                std::memcpy(data + i, &value, sizeof(value));
+            }
+            for (; i < size; ++i) {
+                data[i] ^= pattern[i & 7U];
+            }
+        }
+
+#ifdef WEBSOCKET_FRAME_CODEC_SSE2
+        inline void maskSse2(uint8_t* data, size_t size, const MaskKey& key, size_t offset) noexcept {
+            alignas(16) uint8_t pattern[16];
+            fillPattern(pattern, sizeof(pattern), key, offset);
+            const auto pattern128 = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+            size_t i = 0U;
+            for (; i + 64U <= size; i += 64U) {
+                auto chunk = reinterpret_cast<__m128i*>(data + i);
+                const auto v0 = _mm_loadu_si128(chunk + 0);
+                const auto v1 = _mm_loadu_si128(chunk + 1);
+                const auto v2 = _mm_loadu_si128(chunk + 2);
+                const auto v3 = _mm_loadu_si128(chunk + 3);
+                _mm_storeu_si128(chunk + 0, _mm_xor_si128(v0, pattern128));
+                _mm_storeu_si128(chunk + 1, _mm_xor_si128(v1, pattern128));
+                _mm_storeu_si128(chunk + 2, _mm_xor_si128(v2, pattern128));
+                _mm_storeu_si128(chunk + 3, _mm_xor_si128(v3, pattern128));
+            }
+            for (; i + 16U <= size; i += 16U) {
+                auto chunk = reinterpret_cast<__m128i*>(data + i);
+                _mm_storeu_si128(chunk, _mm_xor_si128(_mm_loadu_si128(chunk), pattern128));
+            }
+            maskScalar(data + i, size - i, key, offset + i);
+        }
+#endif
+
+#ifdef WEBSOCKET_FRAME_CODEC_AVX2
+#ifdef WEBSOCKET_FRAME_CODEC_AVX2_DISPATCH
+        __attribute__((target("avx2")))
+#endif
+        inline void maskAvx2(uint8_t* data, size_t size, const MaskKey& key, size_t offset) noexcept {
+            alignas(32) uint8_t pattern[32];
+            fillPattern(pattern, sizeof(pattern), key, offset);
+            const auto pattern256 = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern));
+            size_t i = 0U;
+            for (; i + 128U <= size; i += 128U) {
+                auto chunk = reinterpret_cast<__m256i*>(data + i);
+                const auto v0 = _mm256_loadu_si256(chunk + 0);
+                const auto v1 = _mm256_loadu_si256(chunk + 1);
+                const auto v2 = _mm256_loadu_si256(chunk + 2);
+                const auto v3 = _mm256_loadu_si256(chunk + 3);
+                _mm256_storeu_si256(chunk + 0, _mm256_xor_si256(v0, pattern256));
+                _mm256_storeu_si256(chunk + 1, _mm256_xor_si256(v1, pattern256));
+                _mm256_storeu_si256(chunk + 2, _mm256_xor_si256(v2, pattern256));
+                _mm256_storeu_si256(chunk + 3, _mm256_xor_si256(v3, pattern256));
+            }
+            for (; i + 32U <= size; i += 32U) {
+                auto chunk = reinterpret_cast<__m256i*>(data + i);
+                _mm256_storeu_si256(chunk, _mm256_xor_si256(_mm256_loadu_si256(chunk), pattern256));
+            }
+            maskScalar(data + i, size - i, key, offset + i);
+        }
+
+        inline bool hasAvx2() noexcept {
+#ifdef WEBSOCKET_FRAME_CODEC_AVX2_DISPATCH
+            static const bool avx2 = __builtin_cpu_supports("avx2");
+            return avx2;
+#else
+            return true;
+#endif
+        }
+#endif
+
+#ifdef WEBSOCKET_FRAME_CODEC_NEON
+        inline void maskNeon(uint8_t* data, size_t size, const MaskKey& key, size_t offset) noexcept {
+            uint8_t pattern[16];
+            fillPattern(pattern, sizeof(pattern), key, offset);
+            const auto pattern128 = vld1q_u8(pattern);
+            size_t i = 0U;
+            for (; i + 64U <= size; i += 64U) {
+                const auto v0 = vld1q_u8(data + i);
+                const auto v1 = vld1q_u8(data + i + 16U);
+                const auto v2 = vld1q_u8(data + i + 32U);
+                const auto v3 = vld1q_u8(data + i + 48U);
+                vst1q_u8(data + i, veorq_u8(v0, pattern128));
+                vst1q_u8(data + i + 16U, veorq_u8(v1, pattern128));
+                vst1q_u8(data + i + 32U, veorq_u8(v2, pattern128));
+                vst1q_u8(data + i + 48U, veorq_u8(v3, pattern128));
+            }
+            for (; i + 16U <= size; i += 16U) {
+                vst1q_u8(data + i, veorq_u8(vld1q_u8(data + i), pattern128));
+            }
+            maskScalar(data + i, size - i, key, offset + i);
+        }
+#endif
+    } // namespace Details
+
+    /**
+     * @brief Masks or unmasks the frame payload in place.
+     *
+     * Masking is a symmetric XOR operation, so the same routine is used in both directions.
+     * The fastest available kernel (AVX2, SSE2, NEON or a word-at-a-time scalar fallback)
+     * is selected at compile time, AVX2 is additionally detected at runtime on GCC and Clang.
+     * Payload may be processed by chunks, [offset] is the position of the first byte
+     * of [data] within the frame payload.
+     *
+     * @param data Pointer to the payload bytes to be transformed.
+     * @param size The number of bytes to transform.
+     * @param key The masking key of the frame.
+     * @param offset The position of [data] within the frame payload (default: 0).
+     */
+    inline void mask(uint8_t* data, size_t size, const MaskKey& key, size_t offset = 0U) noexcept {
+        if (!data || 0U == size) {
+            return;
+        }
+        offset &= 3U;
+#ifdef WEBSOCKET_FRAME_CODEC_AVX2
+        if (size >= 64U && Details::hasAvx2()) {
+            Details::maskAvx2(data, size, key, offset);
+            return;
+        }
+#endif
+#if defined(WEBSOCKET_FRAME_CODEC_SSE2)
+        if (size >= 16U) {
+            Details::maskSse2(data, size, key, offset);
+            return;
+        }
+#elif defined(WEBSOCKET_FRAME_CODEC_NEON)
+        if (size >= 16U) {
+            Details::maskNeon(data, size, key, offset);
+            return;
+        }
+#endif
+        Details::maskScalar(data, size, key, offset);
+    }
+
+    /**
+     * @brief Unmasks the frame payload in place, an alias of `mask`.
+     */
+    inline void unmask(uint8_t* data, size_t size, const MaskKey& key, size_t offset = 0U) noexcept {
+        mask(data, size, key, offset);
+    }
+
+    /**
+     * @brief Calculates the size of the frame header.
+     *
+     * @param payloadSize The size of the frame payload.
+     * @param masked `true` if the frame carries a masking key.
+     * @return The size of the header in bytes, never exceeds `MaxHeaderSize`.
+     */
+    inline constexpr size_t headerSize(uint64_t payloadSize, bool masked) noexcept {
+        return 2U + (payloadSize < 126U ? 0U : (payloadSize <= 0xFFFFU ? 2U : 8U)) + (masked ? 4U : 0U);
+    }
+
+    /**
+     * @brief Writes the frame header into the caller-provided buffer.
+     *
+     * @param out The destination buffer, must have at least `headerSize(payloadSize, key != nullptr)` bytes.
+     * @param opcode The frame opcode.
+     * @param fin `true` for the final frame of the message.
+     * @param payloadSize The size of the frame payload.
+     * @param key The masking key, `nullptr` for unmasked (server-to-client) frames.
+     * @param rsv1 Value of the RSV1 bit, set for compressed messages.
+     * @return The number of bytes written.
+     */
+    inline size_t writeHeader(uint8_t* out, Opcode opcode, bool fin, uint64_t payloadSize,
+                              const MaskKey* key = nullptr, bool rsv1 = false) noexcept {
+        size_t pos = 0U;
+        out[pos++] = static_cast<uint8_t>((fin ? 0x80U : 0U) | (rsv1 ? 0x40U : 0U) |
+                                          static_cast<uint8_t>(opcode));
+        const uint8_t maskBit = key ? 0x80U : 0U;
+        if (payloadSize < 126U) {
+            out[pos++] = static_cast<uint8_t>(maskBit | payloadSize);
+        }
+        else if (payloadSize <= 0xFFFFU) {
+            out[pos++] = static_cast<uint8_t>(maskBit | 126U);
+            out[pos++] = static_cast<uint8_t>(payloadSize >> 8);
+            out[pos++] = static_cast<uint8_t>(payloadSize);
+        }
+        else {
+            out[pos++] = static_cast<uint8_t>(maskBit | 127U);
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                out[pos++] = static_cast<uint8_t>(payloadSize >> shift);
+            }
+        }
+        if (key) {
+            std::memcpy(out + pos, key->data(), key->size());
+            pos += key->size();
+        }
+        return pos;
+    }
+} // namespace FrameCodec
+
+} // namespace Websocket
@@ -0,0 +1,443 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketFrameDecoder.h
+#include "WebsocketCloseCode.h"
+#include "WebsocketFrameCodec.h"
+#include "WebsocketOpcode.h"
+#include "WebsocketUtf8Validator.h"
+#include <algorithm>
+#include <string_view>
+
+namespace Websocket
+{
+
+/**
+ * @brief An interface class for receiving events from the `FrameDecoder`.
+ *
+ * Events map directly onto `Listener` callbacks: message fragments onto
+ * `onTextFragment`/`onBinaryFragment` (or onto `onTextMessage`/`onBinaryMessage`
+ * when both `first` and `last` flags are set, no buffering required), pongs onto `onPong`,
+ * protocol errors onto closing of the connection with the given close code.
+ * All pointers are valid only for the duration of the call.
+ */
+class FrameListener
+{
+public:
+    /**
+     * @brief Called for each decoded part of a text or binary message.
+     *
+     * A part is a frame payload or a piece of it, if the frame was received by several reads.
+     * Text parts are already validated unless the message is compressed.
+     *
+     * @param opcode `Opcode::Text` or `Opcode::Binary`.
+     * @param compressed `true` if the message is compressed by permessage-deflate (RSV1 bit).
+     * @param data Pointer to the unmasked payload bytes.
+     * @param size The number of payload bytes.
+     * @param first `true` if this is the first part of the message.
+     * @param last `true` if this is the final part of the message.
+     */
+    virtual void onMessageFragment(Opcode /*opcode*/, bool /*compressed*/,
+                                   const uint8_t* /*data*/, size_t /*size*/,
+                                   bool /*first*/, bool /*last*/) {}
+
+    /**
+     * @brief Called when a ping frame is received.
+     *
+     * @param payload Pointer to the unmasked payload bytes.
+     * @param size The number of payload bytes, never exceeds 125.
+     */
+    virtual void onPing(const uint8_t* /*payload*/, size_t /*size*/) {}
+
+    /**
+     * @brief Called when a pong frame is received.
+     *
+     * @param payload Pointer to the unmasked payload bytes.
+     * @param size The number of payload bytes, never exceeds 125.
+     */
+    virtual void onPong(const uint8_t* /*payload*/, size_t /*size*/) {}
+
+    /**
+     * @brief Called when a close frame is received.
+     *
+     * @param code The close code sent by the peer, `CloseCode::NoStatus` if absent.
+     * @param reason The close reason, valid UTF-8.
+     */
+    virtual void onClose(uint16_t /*code*/, std::string_view /*reason*/) {}
+
+    /**
+     * @brief Called when the received data violates the protocol.
+     *
+     * Decoding is stopped, the connection should be closed with the given code.
+     *
+     * @param closeCode One of `CloseCode` values, such as `CloseCode::ProtocolError`,
+     *                  `CloseCode::InvalidPayload` or `CloseCode::MessageTooBig`.
+     * @param details Human-readable description of the violation.
+     */
+    virtual void onProtocolError(uint16_t /*closeCode*/, std::string_view /*details*/) {}
+
+protected:
+    virtual ~FrameListener() = default;
+};
+
+/**
+ * @brief Incremental decoder of websocket frames.
+ *
+ * The `FrameDecoder` class accepts arbitrary chunks of bytes as they arrive from the socket,
+ * tracks partial headers and payloads across reads and reports decoded frames to `FrameListener`.
+ * Payloads are unmasked and reported in place, control frames are collected into an internal
+ * fixed-size buffer, so decoding never allocates memory.
+ * Text messages are validated incrementally, see `Utf8Validator`.
+ */
+class FrameDecoder
+{
+    enum class State
+    {
+        Header,
+        Payload,
+        Closed,
+        Failed
+    };
+
+public:
+    /**
+     * @brief Constructs the decoder.
+     *
+     * @param listener The receiver of decoded frames, must outlive the decoder.
+     * @param server `true` for the server side, which requires masked frames,
+     *               `false` for the client side, which requires unmasked frames.
+     * @param maxMessageSize Maximal allowed size of a message, 0 means no limit.
+     * @param perMessageDeflate `true` if the permessage-deflate extension was negotiated.
+     */
+    FrameDecoder(FrameListener& listener, bool server,
+                 uint64_t maxMessageSize = 0U, bool perMessageDeflate = false) noexcept;
+
+    /**
+     * @brief Decodes the next chunk of received bytes.
+     *
+     * The chunk is unmasked in place, listener callbacks are invoked synchronously.
+     * Bytes received after the close frame are ignored.
+     *
+     * @param data Pointer to the received bytes.
+     * @param size The number of received bytes.
+     * @return `false` if a protocol violation was detected, now or earlier, otherwise `true`.
+     */
+    bool decode(uint8_t* data, size_t size);
+
+    /**
+     * @brief Checks whether a protocol violation was detected.
+     *
+     * @return `true` if decoding was stopped due to an error.
+     */
+    bool failed() const noexcept { return State::Failed == _state; }
+
+    /**
+     * @brief Checks whether the close frame was received.
+     *
+     * @return `true` if the peer has closed the connection.
+     */
+    bool closed() const noexcept { return State::Closed == _state; }
+
+    /**
+     * @brief Resets the decoder to the initial state, for example before reconnection.
+     */
+    void reset() noexcept;
+
+private:
+    size_t requiredHeaderSize() const noexcept;
+    size_t consumeHeader(const uint8_t* data, size_t size);
+    size_t consumePayload(uint8_t* data, size_t size);
+    bool parseHeader();
+    void deliverData(const uint8_t* data, size_t size, bool frameEnd);
+    void deliverControl();
+    void fail(uint16_t closeCode, std::string_view details);
+    static bool isValidCloseCode(uint16_t code) noexcept;
+
+private:
+    FrameListener& _listener;
+    const bool _server;
+    const uint64_t _maxMessageSize;
+    const bool _perMessageDeflate;
+    State _state = State::Header;
+    Utf8Validator _utf8;
+    // current frame
+    uint8_t _header[FrameCodec::MaxHeaderSize] = {};
+    size_t _headerSize = 0U;
+    uint8_t _control[FrameCodec::MaxControlPayloadSize] = {};
+    Opcode _opcode = Opcode::Continuation;
+    bool _fin = false;
+    bool _masked = false;
+    FrameCodec::MaskKey _key = {};
+    uint64_t _payloadSize = 0U;
+    uint64_t _payloadOffset = 0U;
+    // current message, opcode is 'Continuation' if there is no message in progress
+    Opcode _messageOpcode = Opcode::Continuation;
+    bool _messageCompressed = false;
+    bool _messageFirst = false;
+    uint64_t _messageSize = 0U;
+};
+
+inline FrameDecoder::FrameDecoder(FrameListener& listener, bool server,
+                                  uint64_t maxMessageSize, bool perMessageDeflate) noexcept
+    : _listener(listener)
+    , _server(server)
+    , _maxMessageSize(maxMessageSize)
+    , _perMessageDeflate(perMessageDeflate)
+{
+}
+
+inline bool FrameDecoder::decode(uint8_t* data, size_t size) {
+    while (data && size) {
+        size_t used = 0U;
+        switch (_state) {
+            case State::Header:
+                used = consumeHeader(data, size);
+                break;
+            case State::Payload:
+                used = consumePayload(data, size);
+                break;
+            default:
+                return !failed();
+        }
+        data += used;
+        size -= used;
+    }
+    return !failed();
+}
+
+inline void FrameDecoder::reset() noexcept {
+    _state = State::Header;
+    _utf8.reset();
+    _headerSize = 0U;
+    _payloadSize = _payloadOffset = 0U;
+    _messageOpcode = Opcode::Continuation;
+    _messageCompressed = _messageFirst = false;
+    _messageSize = 0U;
+}
+
+inline size_t FrameDecoder::requiredHeaderSize() const noexcept {
+    // 126 & 127 markers of 7-bit length give the size of extended payload length field
+    const uint8_t length = _header[1] & 0x7FU;
+    const size_t extended = 126U == length ? 2U : (127U == length ? 8U : 0U);
+    return 2U + extended + (0U != (_header[1] & 0x80U) ? 4U : 0U);
+}
+
+inline size_t FrameDecoder::consumeHeader(const uint8_t* data, size_t size) {
+    size_t used = 0U;
+    size_t required = _headerSize < 2U ? 2U : requiredHeaderSize();
+    while (_headerSize < required) {
+        const auto count = std::min(required - _headerSize, size - used);
+        if (0U == count) {
+            return used; // wait for the rest of header
+        }
+        std::memcpy(_header + _headerSize, data + used, count);
+        _headerSize += count;
+        used += count;
+        if (2U == _headerSize) {
+            required = requiredHeaderSize();
+        }
+    }
+    _headerSize = 0U;
+    if (parseHeader()) {
+        if (0U == _payloadSize) {
+            if (isControl(_opcode)) {
+                deliverControl();
+            }
+            else {
+                deliverData(nullptr, 0U, true);
+            }
+        }
+        else {
+            _state = State::Payload;
+        }
+    }
+    return used;
+}
+
+inline size_t FrameDecoder::consumePayload(uint8_t* data, size_t size) {
+    const auto count = static_cast<size_t>(std::min<uint64_t>(size, _payloadSize - _payloadOffset));
+    if (_masked) {
+        FrameCodec::unmask(data, count, _key, static_cast<size_t>(_payloadOffset));
+    }
+    const bool frameEnd = _payloadOffset + count == _payloadSize;
+    if (frameEnd) {
+        _state = State::Header;
+    }
+    if (isControl(_opcode)) {
+        std::memcpy(_control + _payloadOffset, data, count);
+        _payloadOffset += count;
+        if (frameEnd) {
+            deliverControl();
+        }
+    }
+    else {
+        _payloadOffset += count;
+        deliverData(data, count, frameEnd);
+    }
+    return count;
+}
+
+inline bool FrameDecoder::parseHeader() {
+    const uint8_t b0 = _header[0], b1 = _header[1];
+    _fin = 0U != (b0 & 0x80U);
+    const bool rsv1 = 0U != (b0 & 0x40U);
+    _opcode = static_cast<Opcode>(b0 & 0x0FU);
+    _masked = 0U != (b1 & 0x80U);
+    uint64_t payloadSize = b1 & 0x7FU;
+    size_t pos = 2U;
+    if (126U == payloadSize) {
+        payloadSize = (uint64_t(_header[2]) << 8) | _header[3];
+        pos = 4U;
+    }
+    else if (127U == payloadSize) {
+        payloadSize = 0U;
+        for (; pos < 10U; ++pos) {
+            payloadSize = (payloadSize << 8) | _header[pos];
+        }
+        if (payloadSize >> 63) {
+            fail(CloseCode::ProtocolError, "invalid payload length");
+            return false;
+        }
+    }
+    if (_masked) {
+        std::memcpy(_key.data(), _header + pos, _key.size());
+    }
+    if (0U != (b0 & 0x30U)) {
+        fail(CloseCode::ProtocolError, "reserved bits are set");
+        return false;
+    }
+    if (_masked != _server) {
+        fail(CloseCode::ProtocolError, _server ? "unmasked client frame" : "masked server frame");
+        return false;
+    }
+    switch (_opcode) {
+        case Opcode::Continuation:
+            if (Opcode::Continuation == _messageOpcode) {
+                fail(CloseCode::ProtocolError, "unexpected continuation frame");
+                return false;
+            }
+            if (rsv1) {
+                fail(CloseCode::ProtocolError, "RSV1 bit is set on continuation frame");
+                return false;
+            }
+            break;
+        case Opcode::Text:
+        case Opcode::Binary:
+            if (Opcode::Continuation != _messageOpcode) {
+                fail(CloseCode::ProtocolError, "data frame inside of fragmented message");
+                return false;
+            }
+            if (rsv1 && !_perMessageDeflate) {
+                fail(CloseCode::ProtocolError, "RSV1 bit is set without negotiated compression");
+                return false;
+            }
+            _messageOpcode = _opcode;
+            _messageCompressed = rsv1;
+            _messageFirst = true;
+            _messageSize = 0U;
+            _utf8.reset();
+            break;
+        case Opcode::Close:
+        case Opcode::Ping:
+        case Opcode::Pong:
+            if (!_fin || rsv1 || payloadSize > FrameCodec::MaxControlPayloadSize) {
+                fail(CloseCode::ProtocolError, "malformed control frame");
+                return false;
+            }
+            break;
+        default:
+            fail(CloseCode::ProtocolError, "unknown opcode");
+            return false;
+    }
+    if (!isControl(_opcode)) {
+        if (_maxMessageSize && payloadSize > _maxMessageSize - _messageSize) {
+            fail(CloseCode::MessageTooBig, "message size exceeds the limit");
+            return false;
+        }
+        _messageSize += payloadSize;
+    }
+    _payloadSize = payloadSize;
+    _payloadOffset = 0U;
+    return true;
+}
+
+inline void FrameDecoder::deliverData(const uint8_t* data, size_t size, bool frameEnd) {
+    const bool last = frameEnd && _fin;
+    if (Opcode::Text == _messageOpcode && !_messageCompressed) {
+        if (!_utf8.validate(data, size) || (last && !_utf8.complete())) {
+            fail(CloseCode::InvalidPayload, "invalid UTF-8 in text message");
+            return;
+        }
+    }
+    if (size || last) {
+        const auto opcode = _messageOpcode;
+        const bool first = _messageFirst;
+        _messageFirst = false;
+        if (last) {
+            _messageOpcode = Opcode::Continuation;
+        }
+        _listener.onMessageFragment(opcode, _messageCompressed, data, size, first, last);
+    }
+}
+
+inline void FrameDecoder::deliverControl() {
+    const auto size = static_cast<size_t>(_payloadSize);
+    switch (_opcode) {
+        case Opcode::Ping:
+            _listener.onPing(_control, size);
+            break;
+        case Opcode::Pong:
+            _listener.onPong(_control, size);
+            break;
+        case Opcode::Close:
+            if (0U == size) {
+                _state = State::Closed;
+                _listener.onClose(CloseCode::NoStatus, {});
+            }
+            else if (1U == size) {
+                fail(CloseCode::ProtocolError, "malformed close frame");
+            }
+            else {
+                const auto code = static_cast<uint16_t>((_control[0] << 8) | _control[1]);
+                const std::string_view reason(reinterpret_cast<const char*>(_control + 2), size - 2U);
+                if (!isValidCloseCode(code)) {
+                    fail(CloseCode::ProtocolError, "invalid close code");
+                }
+                else if (!Utf8Validator::isValid(reason)) {
+                    fail(CloseCode::InvalidPayload, "invalid UTF-8 in close reason");
+                }
+                else {
+                    _state = State::Closed;
+                    _listener.onClose(code, reason);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+inline void FrameDecoder::fail(uint16_t closeCode, std::string_view details) {
+    _state = State::Failed;
+    _listener.onProtocolError(closeCode, details);
+}
+
+inline bool FrameDecoder::isValidCloseCode(uint16_t code) noexcept {
+    if (code >= 3000U && code <= 4999U) {
+        return true; // registered & private codes
+    }
+    return code >= CloseCode::Normal && code <= CloseCode::BadGateway &&
+           code != 1004U && code != CloseCode::NoStatus && code != CloseCode::AbnormalClose;
+}
+
+} // namespace Websocket
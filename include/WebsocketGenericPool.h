@@ -0,0 +1,274 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketGenericPool.h
+#include "WebsocketEndPoint.h"
+#include "WebsocketPool.h"
+#include "WebsocketState.h"
+#include "WebsocketStats.h"
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Websocket
+{
+
+/**
+ * @brief Pool of pre-warmed endpoints built on the public `EndPoint` interface only.
+ *
+ * Works with any implementation: endpoints are created by the factory function and
+ * opened by `EndPoint::open`, health is checked by `EndPoint::state`. There is no
+ * background thread, health checks and refilling run inside `warmUp`, `acquire` and
+ * `release` once per `PoolOptions::_refillInterval`, and after each acquisition for its key.
+ * All methods are thread-safe, endpoints are opened outside of the internal lock.
+ */
+class GenericPool : public Pool
+{
+public:
+    /**
+     * @brief Function creating a new, not opened endpoint, e.g. `Factory::create`.
+     */
+    using Creator = std::function<std::unique_ptr<EndPoint>()>;
+
+    /**
+     * @brief Constructs the pool.
+     *
+     * @param creator The function creating endpoints, must outlive the pool.
+     * @param options The configuration options of the pool.
+     */
+    GenericPool(Creator creator, PoolOptions options)
+        : _creator(std::move(creator))
+        , _options(std::move(options))
+    {
+    }
+
+    // impl. of Pool
+    PoolKey warmUp(Options options) override;
+    std::unique_ptr<EndPoint> acquire(PoolKey key) override;
+    void release(std::unique_ptr<EndPoint> endPoint) override;
+    PoolStats stats() const override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using Endpoints = std::vector<std::unique_ptr<EndPoint>>;
+    struct Target
+    {
+        Options _options;
+        std::deque<std::unique_ptr<EndPoint>> _idle;
+        // endpoints being opened outside of the lock
+        size_t _opening = 0U;
+    };
+
+    // creates & opens an endpoint, `nullptr` if it failed
+    std::unique_ptr<EndPoint> open(const Options& options, PoolKey key) const;
+    // moves unhealthy idle endpoints of all keys to [evicted] if the refill interval elapsed,
+    // returns keys to refill, must be called under the lock
+    std::vector<PoolKey> healthCheck(Clock::time_point now, Endpoints& evicted);
+    // opens endpoints until the number of idle & opening endpoints of the key reaches the limit
+    void refill(PoolKey key);
+    // closes evicted endpoints & refills keys, must be called outside of the lock
+    void maintain(Endpoints& evicted, const std::vector<PoolKey>& refills);
+
+private:
+    const Creator _creator;
+    const PoolOptions _options;
+    mutable std::mutex _mutex;
+    std::unordered_map<PoolKey, Target> _targets;
+    // keys of endpoints handed out by `acquire`, by `EndPoint::id`
+    std::unordered_map<uint64_t, PoolKey> _acquired;
+    PoolKey _lastKey = 0U;
+    Clock::time_point _lastHealthCheck = Clock::now();
+    uint64_t _hits = 0U;
+    uint64_t _misses = 0U;
+    uint64_t _evictions = 0U;
+    LatencyHistogram _acquireLatency;
+};
+
+inline PoolKey GenericPool::warmUp(Options options) {
+    if (!_creator) {
+        return 0U;
+    }
+    PoolKey key = 0U;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        key = ++_lastKey;
+        _targets[key]._options = std::move(options);
+    }
+    refill(key);
+    return key;
+}
+
+inline std::unique_ptr<EndPoint> GenericPool::acquire(PoolKey key) {
+    const auto start = Clock::now();
+    std::unique_ptr<EndPoint> endPoint;
+    Options options;
+    Endpoints evicted;
+    std::vector<PoolKey> refills;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        refills = healthCheck(start, evicted);
+        const auto it = _targets.find(key);
+        if (_targets.end() == it) {
+            return nullptr;
+        }
+        auto& idle = it->second._idle;
+        // connected endpoints first, then the oldest of connecting ones
+        auto connected = idle.begin();
+        while (idle.end() != connected && State::Connected != (*connected)->state()) {
+            ++connected;
+        }
+        if (idle.end() != connected) {
+            endPoint = std::move(*connected);
+            idle.erase(connected);
+            ++_hits;
+        }
+        else {
+            if (!idle.empty()) {
+                endPoint = std::move(idle.front());
+                idle.pop_front();
+            }
+            else {
+                options = it->second._options;
+            }
+            ++_misses;
+        }
+    }
+    if (!endPoint) {
+        endPoint = open(options, key);
+    }
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        if (endPoint) {
+            _acquired[endPoint->id()] = key;
+        }
+        _acquireLatency.add(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start));
+    }
+    refills.push_back(key);
+    maintain(evicted, refills);
+    return endPoint;
+}
+
+inline void GenericPool::release(std::unique_ptr<EndPoint> endPoint) {
+    if (!endPoint) {
+        return;
+    }
+    endPoint->resetListener();
+    const auto healthy = State::Connected == endPoint->state();
+    Endpoints evicted;
+    std::vector<PoolKey> refills;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        refills = healthCheck(Clock::now(), evicted);
+        const auto acquired = _acquired.find(endPoint->id());
+        if (_acquired.end() != acquired) {
+            const auto target = _targets.find(acquired->second);
+            _acquired.erase(acquired);
+            if (!healthy) {
+                ++_evictions;
+            }
+            else if (_targets.end() != target && target->second._idle.size() < _options._endpointsPerKey) {
+                target->second._idle.push_back(std::move(endPoint));
+            }
+        }
+    }
+    // surplus or unhealthy endpoints are closed outside of the lock
+    if (endPoint) {
+        endPoint->close();
+        endPoint.reset();
+    }
+    maintain(evicted, refills);
+}
+
+inline PoolStats GenericPool::stats() const {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    PoolStats stats;
+    stats._hits = _hits;
+    stats._misses = _misses;
+    stats._evictions = _evictions;
+    stats._acquireLatencyP50 = _acquireLatency.percentile(50.);
+    stats._acquireLatencyP99 = _acquireLatency.percentile(99.);
+    stats._acquireLatencyP999 = _acquireLatency.percentile(99.9);
+    return stats;
+}
+
+inline std::unique_ptr<EndPoint> GenericPool::open(const Options& options, PoolKey key) const {
+    auto endPoint = _creator();
+    if (endPoint && endPoint->open(options, key)) {
+        return endPoint;
+    }
+    return nullptr;
+}
+
+inline std::vector<PoolKey> GenericPool::healthCheck(Clock::time_point now, Endpoints& evicted) {
+    std::vector<PoolKey> keys;
+    if (now - _lastHealthCheck >= _options._refillInterval) {
+        _lastHealthCheck = now;
+        for (auto& [key, target] : _targets) {
+            const auto size = target._idle.size();
+            for (auto it = target._idle.begin(); it != target._idle.end();) {
+                const auto state = (*it)->state();
+                if (State::Connected == state || State::Connecting == state) {
+                    ++it;
+                }
+                else {
+                    evicted.push_back(std::move(*it));
+                    it = target._idle.erase(it);
+                    ++_evictions;
+                }
+            }
+            if (size != target._idle.size() || size < _options._endpointsPerKey) {
+                keys.push_back(key);
+            }
+        }
+    }
+    return keys;
+}
+
+inline void GenericPool::maintain(Endpoints& evicted, const std::vector<PoolKey>& refills) {
+    // unhealthy endpoints are closed like the released ones, e.g. to stop reconnection
+    for (auto& endPoint : evicted) {
+        endPoint->close();
+        endPoint.reset();
+    }
+    for (const auto key : refills) {
+        refill(key);
+    }
+}
+
+inline void GenericPool::refill(PoolKey key) {
+    for (;;) {
+        Options options;
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _targets.find(key);
+            if (_targets.end() == it || it->second._idle.size() + it->second._opening >= _options._endpointsPerKey) {
+                return;
+            }
+            ++it->second._opening;
+            options = it->second._options;
+        }
+        auto endPoint = open(options, key);
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto& target = _targets[key];
+        --target._opening;
+        if (!endPoint) {
+            // retried by the next health check
+            return;
+        }
+        target._idle.push_back(std::move(endPoint));
+    }
+}
+
+} // namespace Websocket
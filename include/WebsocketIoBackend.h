@@ -0,0 +1,80 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketIoBackend.h
+#include <cstdint>
+
+namespace Websocket
+{
+
+/**
+ * @brief Enum class representing mechanisms of socket I/O.
+ */
+enum class IoBackend
+{
+    /**
+     * @brief The default mechanism of the implementation.
+     */
+    Default,
+
+    /**
+     * @brief Readiness-based I/O through Linux `epoll`.
+     */
+    Epoll,
+
+    /**
+     * @brief Requests the Linux `io_uring` backend if the implementation provides one,
+     * see `Factory::supports`.
+     */
+    IoUring
+};
+
+/**
+ * @brief Represents tuning parameters of the `IoBackend::IoUring` backend.
+ *
+ * Ignored by implementations that don't provide the backend.
+ */
+struct IoUringOptions
+{
+    /**
+     * @brief The number of submission queue entries of the ring.
+     */
+    uint32_t _queueDepth = 4096U;
+
+    /**
+     * @brief Enable kernel-side submission queue polling (`IORING_SETUP_SQPOLL`).
+     */
+    bool _sqPoll = false;
+};
+
+/**
+ * @brief Converts an `IoBackend` value to its string representation.
+ *
+ * @param backend The `IoBackend` enum value to convert.
+ * @return A constant character pointer representing the string version of the backend.
+ */
+inline const char* toString(IoBackend backend) {
+    switch (backend) {
+        case IoBackend::Default:
+            return "default";
+        case IoBackend::Epoll:
+            return "epoll";
+        case IoBackend::IoUring:
+            return "io_uring";
+        default:
+            break;
+    }
+    return "unknown";
+}
+
+} // namespace Websocket
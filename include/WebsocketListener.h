@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once // WebsocketListener.h
+#include "WebsocketMessageView.h"
+#include <chrono>
+#include <memory>
 #include <string_view>
 
 // prototype defined in 'Bricks' library,
@@ -32,6 +35,7 @@ enum class State;
  * The `Listener` class defines callback methods for handling various WebSocket events,
  * such as state changes, errors, and incoming messages. Classes that wish to handle these
  * events should inherit from `Listener` and override the necessary methods.
+ * The thread of callbacks and ordering guarantees are defined by `Options::_callbackDelivery`.
  */
 class Listener
 {
@@ -61,6 +65,10 @@ public:
     /**
      * @brief Called when a text message is received on the websocket connection.
      *
+     * The message is guaranteed to be valid UTF-8, endpoints validate incoming text
+     * (see `Utf8Validator`) and close the connection with `CloseCode::InvalidPayload`
+     * reporting `Failure::InvalidText` error otherwise.
+     *
      * @param socketId The unique identifier of the websocket socket.
      * @param connectionId The unique identifier of the websocket connection.
      * @param message The received text message.
@@ -72,6 +80,9 @@ public:
     /**
      * @brief Called when a binary message is received on the websocket connection.
      *
+     * The blob is valid only for the duration of the call,
+     * use `onSharedBinaryMessage` to keep the payload without copying.
+     *
      * @param socketId The unique identifier of the websocket socket.
      * @param connectionId The unique identifier of the websocket connection.
      * @param message The received binary message as a blob.
@@ -80,6 +91,97 @@ public:
                                  uint64_t /*connectionId*/,
                                  const Bricks::Blob& /*message*/) {}
 
+    /**
+     * @brief Called when a binary message is received, transfers ownership of the receive buffer.
+     *
+     * Endpoints deliver binary messages through this method, handing the receive buffer
+     * over without copying. The listener may move the pointer to another thread or queue
+     * and keep it as long as needed. The payload is immutable, it may be shared with the sender
+     * (see `EndPoint::sendSharedBinary`) or passed to another endpoint without copying.
+     * The default implementation forwards the message to `onBinaryMessage`.
+     *
+     * @param socketId The unique identifier of the websocket socket.
+     * @param connectionId The unique identifier of the websocket connection.
+     * @param message The received binary message, ownership is shared with the listener.
+     */
+    virtual void onSharedBinaryMessage(uint64_t socketId,
+                                       uint64_t connectionId,
+                                       std::shared_ptr<const Bricks::Blob> message) {
+        if (message) {
+            onBinaryMessage(socketId, connectionId, *message);
+        }
+    }
+
+    /**
+     * @brief Called once for all messages decoded from a single socket read.
+     *
+     * Invoked instead of `onTextMessage` and `onSharedBinaryMessage` if `Options::_batchedDelivery`
+     * is set, so that consumers pay one virtual call (and take one lock) per batch instead
+     * of per message. Messages are in the order of arrival, the views and text payloads
+     * are valid only for the duration of the call, binary payloads are shared by
+     * `MessageView::_sharedBinary` and may be kept. The default implementation calls
+     * `onTextMessage` or `onSharedBinaryMessage` (`onBinaryMessage` for views without
+     * a shared payload) for each message, so enabling batching doesn't change behavior
+     * of listeners which don't override this method.
+     *
+     * @param socketId The unique identifier of the websocket socket.
+     * @param connectionId The unique identifier of the websocket connection.
+     * @param messages Pointer to the first message of the batch.
+     * @param count The number of messages in the batch, at least 1.
+     */
+    virtual void onMessageBatch(uint64_t socketId,
+                                uint64_t connectionId,
+                                const MessageView* messages,
+                                size_t count) {
+        for (size_t i = 0U; i < count; ++i) {
+            if (messages[i]._sharedBinary) {
+                onSharedBinaryMessage(socketId, connectionId, messages[i]._sharedBinary);
+            }
+            else if (messages[i].binary()) {
+                onBinaryMessage(socketId, connectionId, *messages[i]._binary);
+            }
+            else {
+                onTextMessage(socketId, connectionId, messages[i]._text);
+            }
+        }
+    }
+
+    /**
+     * @brief Called for each fragment of a text message when fragmented delivery is enabled.
+     *
+     * Invoked instead of `onTextMessage` if `Options::_fragmentedDelivery` is set,
+     * so that large messages are never buffered in full. Fragment boundaries
+     * may split multi-byte UTF-8 sequences. Validation is incremental, the fragment
+     * is delivered only if the message is valid UTF-8 so far.
+     *
+     * @param socketId The unique identifier of the websocket socket.
+     * @param connectionId The unique identifier of the websocket connection.
+     * @param fragment The received part of the message.
+     * @param first `true` if this is the first fragment of the message.
+     * @param last `true` if this is the final fragment of the message.
+     */
+    virtual void onTextFragment(uint64_t /*socketId*/,
+                                uint64_t /*connectionId*/,
+                                std::string_view /*fragment*/,
+                                bool /*first*/, bool /*last*/) {}
+
+    /**
+     * @brief Called for each fragment of a binary message when fragmented delivery is enabled.
+     *
+     * Invoked instead of `onBinaryMessage` if `Options::_fragmentedDelivery` is set,
+     * so that large messages are never buffered in full.
+     *
+     * @param socketId The unique identifier of the websocket socket.
+     * @param connectionId The unique identifier of the websocket connection.
+     * @param fragment The received part of the message.
+     * @param first `true` if this is the first fragment of the message.
+     * @param last `true` if this is the final fragment of the message.
+     */
+    virtual void onBinaryFragment(uint64_t /*socketId*/,
+                                  uint64_t /*connectionId*/,
+                                  const Bricks::Blob& /*fragment*/,
+                                  bool /*first*/, bool /*last*/) {}
+
     /**
      * @brief Called when a pong response is received for a ping.
      *
@@ -91,6 +193,34 @@ public:
                         uint64_t /*connectionId*/,
                         const Bricks::Blob& /*payload*/) {}
 
+    /**
+     * @brief Called when a pong for an automatic ping is received.
+     *
+     * Automatic pings are enabled by `Options::_pingInterval`, their pongs are reported
+     * by this method instead of `onPong`. Samples are also collected into `Stats::_pingRtt`.
+     *
+     * @param socketId The unique identifier of the websocket socket.
+     * @param connectionId The unique identifier of the websocket connection.
+     * @param rtt The measured round-trip time.
+     */
+    virtual void onRoundTripTime(uint64_t /*socketId*/,
+                                 uint64_t /*connectionId*/,
+                                 std::chrono::microseconds /*rtt*/) {}
+
+    /**
+     * @brief Called when the outgoing queue drains below the low watermark.
+     *
+     * Fired only after the queue reached the high watermark, see `Options::_bufferedHighWatermark`
+     * and `Options::_bufferedLowWatermark`, producers may resume sending.
+     *
+     * @param socketId The unique identifier of the websocket socket.
+     * @param connectionId The unique identifier of the websocket connection.
+     * @param bufferedAmount The number of bytes still queued.
+     */
+    virtual void onWritable(uint64_t /*socketId*/,
+                            uint64_t /*connectionId*/,
+                            uint64_t /*bufferedAmount*/) {}
+
 protected:
     /**
      * @brief Virtual destructor.
@@ -0,0 +1,107 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketMessageView.h
+#include <memory>
+#include <string>
+#include <string_view>
+
+// prototype defined in 'Bricks' library,
+// see https://github.com/ArtiomKhachaturian/Bricks
+namespace Bricks {
+class Blob;
+}
+
+namespace Websocket
+{
+
+/**
+ * @brief View of a single text or binary websocket message.
+ *
+ * The `MessageView` struct refers either to a text payload or to a binary blob,
+ * it never copies the data. Referenced payloads must outlive the call the view
+ * is passed to, unless the binary payload is shared (see `_sharedBinary`).
+ */
+struct MessageView
+{
+    /**
+     * @brief Constructs a view of a text message.
+     *
+     * @param text The text payload.
+     */
+    MessageView(std::string_view text) noexcept : _text(text) {}
+
+    /**
+     * @brief Constructs a view of a text message held by a string.
+     *
+     * Allows brace-initialization of views from strings, e.g.
+     * `std::vector<MessageView>{text1, text2}`, which needs two
+     * user-defined conversions through `std::string_view`.
+     *
+     * @param text The text payload.
+     */
+    MessageView(const std::string& text) noexcept : _text(text) {}
+
+    /**
+     * @brief Constructs a view of a null-terminated text message.
+     *
+     * @param text The text payload, `nullptr` is treated as empty text.
+     */
+    MessageView(const char* text) noexcept : _text(text ? std::string_view(text) : std::string_view()) {}
+
+    /**
+     * @brief Constructs a view of a binary message.
+     *
+     * @param binary The binary payload.
+     */
+    MessageView(const Bricks::Blob& binary) noexcept : _binary(&binary) {}
+
+    /**
+     * @brief Constructs a view of a binary message sharing ownership of the payload.
+     *
+     * @param binary The binary payload, `nullptr` makes a view of empty text.
+     */
+    MessageView(std::shared_ptr<const Bricks::Blob> binary) noexcept
+        : _binary(binary.get())
+        , _sharedBinary(std::move(binary))
+    {
+    }
+
+    /**
+     * @brief Checks whether the view refers to a binary message.
+     *
+     * @return `true` for binary message, `false` for text message.
+     */
+    bool binary() const noexcept { return nullptr != _binary; }
+
+    /**
+     * @brief The text payload, empty for binary messages.
+     */
+    std::string_view _text;
+
+    /**
+     * @brief The binary payload, `nullptr` for text messages.
+     */
+    const Bricks::Blob* _binary = nullptr;
+
+    /**
+     * @brief The owner of the binary payload if it is shared, otherwise `nullptr`.
+     *
+     * Endpoints set it for received binary messages, so that listeners may keep
+     * the payload beyond the call (see `Listener::onSharedBinaryMessage`), and
+     * `EndPoint::sendBatch` may queue it without copying.
+     */
+    std::shared_ptr<const Bricks::Blob> _sharedBinary;
+};
+
+} // namespace Websocket
@@ -0,0 +1,173 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketMpscRing.h
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Websocket
+{
+
+/**
+ * @brief Bounded lock-free multi-producer single-consumer ring buffer.
+ *
+ * The `MpscRing` class is intended for the send path of endpoints: any number of threads
+ * enqueue outgoing messages without blocking, while a single I/O thread drains them
+ * by batches and writes them to the socket. Storage is allocated once in the constructor,
+ * producers contend on a single atomic counter only.
+ * The implementation follows the bounded queue by Dmitry Vyukov, see
+ * https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ *
+ * @tparam T Type of elements, must be default constructible and move assignable.
+ */
+template <typename T>
+class MpscRing
+{
+    static_assert(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>);
+    static constexpr size_t CacheLineSize = 64U;
+
+public:
+    /**
+     * @brief Constructs the ring.
+     *
+     * @param capacity Minimal number of elements, rounded up to the power of two.
+     */
+    explicit MpscRing(size_t capacity);
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator = (const MpscRing&) = delete;
+
+    /**
+     * @brief Enqueues the element, can be called from any thread.
+     *
+     * @param value The element to enqueue.
+     * @return `false` if the ring is full, the value is left untouched in this case.
+     */
+    bool tryPush(T&& value);
+
+    /**
+     * @brief Dequeues the element, must be called from the consumer thread only.
+     *
+     * @param value The receiver of the dequeued element.
+     * @return `false` if the ring is empty.
+     */
+    bool tryPop(T& value);
+
+    /**
+     * @brief Dequeues up to [maxCount] elements, must be called from the consumer thread only.
+     *
+     * @param consumer Callable invoked with `T&&` for each dequeued element, in order of enqueuing.
+     * @param maxCount Maximal number of elements to dequeue.
+     * @return The number of dequeued elements.
+     */
+    template <class Consumer>
+    size_t popBatch(Consumer&& consumer, size_t maxCount = SIZE_MAX);
+
+    /**
+     * @brief Retrieves the capacity of the ring.
+     *
+     * @return The maximal number of elements.
+     */
+    size_t capacity() const noexcept { return _mask + 1U; }
+
+private:
+    static size_t roundUp(size_t capacity) noexcept;
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> _sequence;
+        T _value;
+    };
+    const size_t _mask;
+    const std::unique_ptr<Cell[]> _cells;
+    alignas(CacheLineSize) std::atomic<size_t> _tail = 0U;
+    alignas(CacheLineSize) size_t _head = 0U;
+};
+
+template <typename T>
+inline MpscRing<T>::MpscRing(size_t capacity)
+    : _mask(roundUp(capacity) - 1U)
+    , _cells(std::make_unique<Cell[]>(_mask + 1U))
+{
+    for (size_t i = 0U; i <= _mask; ++i) {
+        _cells[i]._sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+inline bool MpscRing<T>::tryPush(T&& value) {
+    auto pos = _tail.load(std::memory_order_relaxed);
+    for (;;) {
+        auto& cell = _cells[pos & _mask];
+        const auto sequence = cell._sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (0 == diff) {
+            if (_tail.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed)) {
+                cell._value = std::move(value);
+                cell._sequence.store(pos + 1U, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0) {
+            return false; // full
+        }
+        else {
+            pos = _tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+inline bool MpscRing<T>::tryPop(T& value) {
+    auto& cell = _cells[_head & _mask];
+    if (cell._sequence.load(std::memory_order_acquire) != _head + 1U) {
+        return false; // empty or the producer hasn't finished writing yet
+    }
+    value = std::move(cell._value);
+    cell._value = T();
+    cell._sequence.store(_head + _mask + 1U, std::memory_order_release);
+    ++_head;
+    return true;
+}
+
+template <typename T>
+template <class Consumer>
+inline size_t MpscRing<T>::popBatch(Consumer&& consumer, size_t maxCount) {
+    size_t count = 0U;
+    for (; count < maxCount; ++count) {
+        auto& cell = _cells[_head & _mask];
+        if (cell._sequence.load(std::memory_order_acquire) != _head + 1U) {
+            break;
+        }
+        consumer(std::move(cell._value));
+        cell._value = T();
+        cell._sequence.store(_head + _mask + 1U, std::memory_order_release);
+        ++_head;
+    }
+    return count;
+}
+
+template <typename T>
+inline size_t MpscRing<T>::roundUp(size_t capacity) noexcept {
+    size_t result = 2U;
+    while (result < capacity) {
+        result <<= 1U;
+    }
+    return result;
+}
+
+} // namespace Websocket
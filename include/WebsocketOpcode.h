@@ -0,0 +1,83 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketOpcode.h
+#include <cstdint>
+
+namespace Websocket
+{
+
+/**
+ * @brief Enum class representing websocket frame opcodes.
+ *
+ * The `Opcode` enum defines the interpretation of the frame payload,
+ * values are the same as on the wire, see RFC 6455, section 5.2.
+ */
+enum class Opcode : uint8_t
+{
+    /// @brief Continuation frame of a fragmented message.
+    Continuation = 0x0,
+
+    /// @brief Text frame, payload is UTF-8 encoded.
+    Text = 0x1,
+
+    /// @brief Binary frame.
+    Binary = 0x2,
+
+    /// @brief Connection close control frame.
+    Close = 0x8,
+
+    /// @brief Ping control frame.
+    Ping = 0x9,
+
+    /// @brief Pong control frame.
+    Pong = 0xA
+};
+
+/**
+ * @brief Checks whether the opcode denotes a control frame.
+ *
+ * @param opcode The `Opcode` enum value to check.
+ * @return `true` for close, ping and pong opcodes, otherwise `false`.
+ */
+inline constexpr bool isControl(Opcode opcode) noexcept {
+    return 0U != (static_cast<uint8_t>(opcode) & 0x8U);
+}
+
+/**
+ * @brief Converts an `Opcode` value to its string representation.
+ *
+ * @param opcode The `Opcode` enum value to convert.
+ * @return A constant character pointer representing the string version of the opcode.
+ */
+inline const char* toString(Opcode opcode) {
+    switch (opcode) {
+        case Opcode::Continuation:
+            return "continuation";
+        case Opcode::Text:
+            return "text";
+        case Opcode::Binary:
+            return "binary";
+        case Opcode::Close:
+            return "close";
+        case Opcode::Ping:
+            return "ping";
+        case Opcode::Pong:
+            return "pong";
+        default:
+            break;
+    }
+    return "unknown";
+}
+
+} // namespace Websocket
@@ -12,13 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once
+#include "WebsocketCompression.h"
+#include "WebsocketExecutor.h"
+#include "WebsocketReconnect.h"
+#include "WebsocketSendOptions.h"
 #include "WebsocketTls.h"
+#include <chrono>
+#include <memory>
 #include <optional>
 #include <unordered_map>
 
 namespace Websocket
 {
 
+class BufferPool;
+
 /**
  * @brief Represents configurable options for a connection.
  *
@@ -40,7 +48,9 @@ public:
     /**
      * @brief The host URL or URI for the connection.
      *
-     * Specifies the destination address for the connection.
+     * Specifies the destination address for the connection, the URL scheme
+     * selects the transport (see `Scheme`), e.g. `wss://example.com/stream`
+     * `inproc://name/stream` or `ws+unix:///run/app.sock:/stream`.
      */
     std::string _host;
 
@@ -58,7 +68,35 @@ public:
      */
     std::unordered_map<std::string, std::string> _extraHeaders;
 
-    // Socket options
+    /**
+     * @brief Enables delivery of incoming messages by fragments.
+     *
+     * If set to true, incoming messages are passed to `Listener::onTextFragment`
+     * and `Listener::onBinaryFragment` as they arrive, so peak memory is bounded
+     * by the fragment size instead of the message size.
+     */
+    bool _fragmentedDelivery = false;
+
+    /**
+     * @brief Enables batched delivery of incoming messages.
+     *
+     * If set to true, complete messages decoded from one socket read are passed
+     * to `Listener::onMessageBatch` at once. Ignored if `_fragmentedDelivery` is set.
+     */
+    bool _batchedDelivery = false;
+
+    // Event loop settings, see also `ShardingOptions`
+
+    /**
+     * @brief Explicit event-loop shard of the endpoint.
+     *
+     * Overrides `ShardingOptions::_placement` of the factory, ignored by factories
+     * without sharded event loops. Values are taken modulo the number of shards.
+     */
+    std::optional<uint32_t> _shard;
+
+    // Socket options, `_broadcast`, `_doNotRoute`, `_keepAlive` and `_tcpNoDelay`
+    // are ignored for Unix domain sockets (`Scheme::Unix`, `Scheme::SecureUnix`)
 
     /**
      * @brief Enables or disables broadcasting (SO_BROADCAST).
@@ -132,6 +170,100 @@ public:
      */
     std::optional<bool> _tcpNoDelay;
 
+    // Listener callbacks settings
+
+    /**
+     * @brief The policy of `Listener` callbacks delivery.
+     *
+     * See `CallbackDelivery` for the threading and ordering guarantees of each policy.
+     */
+    CallbackDelivery _callbackDelivery = CallbackDelivery::Inline;
+
+    /**
+     * @brief The executor of `Listener` callbacks.
+     *
+     * Required for `CallbackDelivery::Executor` and `CallbackDelivery::Strand` policies,
+     * callbacks are delivered inline if not specified.
+     */
+    std::shared_ptr<Executor> _callbackExecutor;
+
+    // Keepalive settings
+
+    /**
+     * @brief The interval of automatic pings.
+     *
+     * If specified, the endpoint sends a ping each interval and measures the round-trip time
+     * by the matching pong, see `Listener::onRoundTripTime`. Heartbeats of all endpoints
+     * are driven by a shared `TimerWheel`.
+     */
+    std::optional<std::chrono::milliseconds> _pingInterval;
+
+    /**
+     * @brief The maximal period of silence from the peer.
+     *
+     * If nothing (including pongs) is received within this period, the peer is considered dead:
+     * the endpoint reports `Failure::Timeout` error, sends a close frame with
+     * `CloseCode::GoingAway` and drops the connection without waiting for the response.
+     */
+    std::optional<std::chrono::milliseconds> _idleTimeout;
+
+    // Reconnect settings
+
+    /**
+     * @brief The policy of automatic reconnection.
+     *
+     * If specified, lost connections are re-opened with the same options and connection ID,
+     * otherwise the endpoint stays in `State::Disconnected`.
+     */
+    std::optional<ReconnectPolicy> _reconnect;
+
+    // Send queue settings
+
+    /**
+     * @brief The mode of the outgoing messages queue.
+     *
+     * `SendQueue::Conflating` enables priorities and conflation keys of `EndPoint::queueBinary`
+     * and `EndPoint::queueText`, reducing bandwidth and staleness under congestion.
+     */
+    SendQueue _sendQueue = SendQueue::Fifo;
+
+    /**
+     * @brief The high watermark (in bytes) of the outgoing queue.
+     *
+     * If specified, sending of data messages fails while `EndPoint::bufferedAmount()`
+     * is at or above this value, so that a slow peer can't grow the queue without bound.
+     */
+    std::optional<uint64_t> _bufferedHighWatermark;
+
+    /**
+     * @brief The low watermark (in bytes) of the outgoing queue.
+     *
+     * After the high watermark was reached, `Listener::onWritable` is called once
+     * the queue drains below this value. Defaults to the half of the high watermark.
+     */
+    std::optional<uint64_t> _bufferedLowWatermark;
+
+    // Memory settings
+
+    /**
+     * @brief The pool of receive and send frame buffers.
+     *
+     * If specified, frame buffers are acquired from the pool and recycled once the listener
+     * callback returns or the send completes, instead of a heap allocation per frame.
+     * The pool may be shared by many endpoints, see `BufferPool::stats` for its efficiency.
+     */
+    std::shared_ptr<BufferPool> _bufferPool;
+
+    // Compression settings
+
+    /**
+     * @brief permessage-deflate compression options.
+     *
+     * If specified, the permessage-deflate extension is offered during the handshake,
+     * otherwise messages are never compressed.
+     */
+    std::optional<Compression> _compression;
+
     // SSL/TLS settings
 
     /**
@@ -0,0 +1,153 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketPool.h
+#include "WebsocketOptions.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace Websocket
+{
+
+class EndPoint;
+
+/**
+ * @brief Handle of connection options registered by `Pool::warmUp`, 0 is invalid.
+ *
+ * Endpoints are pooled per handle rather than per host, so connections to the same host
+ * with different headers, TLS settings or credentials are never interchanged.
+ */
+using PoolKey = uint64_t;
+
+/**
+ * @brief Represents configurable options of the endpoints pool.
+ */
+struct PoolOptions
+{
+    /**
+     * @brief The number of connected endpoints kept ready for each key (see `Pool::warmUp`).
+     */
+    size_t _endpointsPerKey = 4U;
+
+    /**
+     * @brief The period of background health checks and refilling of the pool.
+     *
+     * Endpoints which are not in `State::Connected` are evicted and replaced by new ones.
+     */
+    std::chrono::milliseconds _refillInterval = std::chrono::seconds(1);
+};
+
+/**
+ * @brief Represents a snapshot of the pool statistics.
+ */
+struct PoolStats
+{
+    /**
+     * @brief The number of acquisitions served by an already connected endpoint.
+     */
+    uint64_t _hits = 0U;
+
+    /**
+     * @brief The number of acquisitions that required opening a new connection.
+     */
+    uint64_t _misses = 0U;
+
+    /**
+     * @brief The number of endpoints evicted because of unhealthy state.
+     */
+    uint64_t _evictions = 0U;
+
+    /**
+     * @brief Median latency of `Pool::acquire`.
+     */
+    std::chrono::microseconds _acquireLatencyP50 = {};
+
+    /**
+     * @brief 99th percentile latency of `Pool::acquire`.
+     */
+    std::chrono::microseconds _acquireLatencyP99 = {};
+
+    /**
+     * @brief 99.9th percentile latency of `Pool::acquire`.
+     */
+    std::chrono::microseconds _acquireLatencyP999 = {};
+
+    /**
+     * @brief Calculates the ratio of acquisitions served from the pool.
+     *
+     * @return The hit rate in range [0, 1].
+     */
+    double hitRate() const noexcept {
+        const auto total = _hits + _misses;
+        return total ? static_cast<double>(_hits) / static_cast<double>(total) : 0.;
+    }
+};
+
+/**
+ * @brief Abstract pool of pre-warmed websocket endpoints.
+ *
+ * The `Pool` class keeps a number of connected endpoints for each set of connection options,
+ * so that acquired endpoints skip DNS resolution, TCP & TLS handshakes and HTTP upgrade.
+ * Unhealthy endpoints are evicted and the pool is refilled in the background.
+ */
+class Pool
+{
+public:
+    /**
+     * @brief Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~Pool() = default;
+
+    /**
+     * @brief Starts keeping connected endpoints opened with the options.
+     *
+     * Each call registers a distinct key, even for equal options. Pooled endpoints are opened
+     * with the key as the connection identifier.
+     *
+     * @param options The complete configuration of pooled connections: host, headers, TLS, etc.
+     * @return The key to pass to `acquire`, 0 if the options are not accepted.
+     */
+    virtual PoolKey warmUp(Options options) = 0;
+
+    /**
+     * @brief Acquires an endpoint connected with options of the key.
+     *
+     * If no connected endpoint is available, a new one is created and opened,
+     * the returned endpoint is in `State::Connecting` in this case.
+     * The caller should set its own listener to the acquired endpoint.
+     *
+     * @param key The key returned by `warmUp`.
+     * @return A `std::unique_ptr` to the endpoint, `nullptr` if the key is unknown
+     *         or the endpoint failed to open.
+     */
+    virtual std::unique_ptr<EndPoint> acquire(PoolKey key) = 0;
+
+    /**
+     * @brief Returns the endpoint to the pool.
+     *
+     * The listener of the endpoint is reset, endpoints not in `State::Connected` are evicted.
+     *
+     * @param endPoint The endpoint previously obtained from `acquire`.
+     */
+    virtual void release(std::unique_ptr<EndPoint> endPoint) = 0;
+
+    /**
+     * @brief Retrieves the pool statistics.
+     *
+     * @return A snapshot of hit rate and acquire latency percentiles.
+     */
+    virtual PoolStats stats() const = 0;
+};
+
+} // namespace Websocket
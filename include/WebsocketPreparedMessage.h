@@ -0,0 +1,181 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketPreparedMessage.h
+#include "WebsocketEndPoint.h"
+#include "WebsocketFrameCodec.h"
+#include "WebsocketUtf8Validator.h"
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Websocket
+{
+
+/**
+ * @brief Immutable websocket message, encoded into a wire frame once.
+ *
+ * The `PreparedMessage` class holds the complete unmasked frame (header and payload)
+ * in a shared buffer, so that the same message can be queued to many endpoints
+ * without framing, compressing or copying the payload again, see `broadcast`.
+ * Unmasked frames are sent as is by server endpoints, client endpoints must mask each frame
+ * with a fresh key and therefore copy the payload.
+ */
+class PreparedMessage
+{
+    // passkey of the public constructor required by `std::make_shared`, available to `create` only
+    struct Private { explicit Private() = default; };
+
+public:
+    /**
+     * @brief Encodes the message into a shared wire frame.
+     *
+     * Frames that peers would reject as protocol violations are never prepared:
+     * `Opcode::Continuation`, `Opcode::Close` and unknown opcodes are refused, pings and pongs
+     * must fit into `FrameCodec::MaxControlPayloadSize` bytes and can't be compressed,
+     * uncompressed text must be valid UTF-8.
+     *
+     * @param opcode `Opcode::Text`, `Opcode::Binary`, `Opcode::Ping` or `Opcode::Pong`.
+     * @param payload Pointer to the payload bytes.
+     * @param size The number of payload bytes.
+     * @param compressed `true` if the payload is already deflated, sets RSV1 bit. Such messages
+     *                   are valid only for endpoints that negotiated permessage-deflate
+     *                   with `Compression::_serverNoContextTakeover`.
+     * @return A shared pointer to the prepared message or `nullptr` if the frame is invalid.
+     */
+    static std::shared_ptr<const PreparedMessage> create(Opcode opcode, const uint8_t* payload,
+                                                         size_t size, bool compressed = false);
+
+    /**
+     * @brief Encodes the text message into a shared wire frame.
+     *
+     * @param text The text message, must be valid UTF-8.
+     * @return A shared pointer to the prepared message or `nullptr` if the text is not valid UTF-8.
+     */
+    static std::shared_ptr<const PreparedMessage> text(std::string_view text) {
+        return create(Opcode::Text, reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    }
+
+    /**
+     * @brief Encodes the binary message into a shared wire frame.
+     *
+     * @param payload Pointer to the payload bytes.
+     * @param size The number of payload bytes.
+     * @return A shared pointer to the prepared message.
+     */
+    static std::shared_ptr<const PreparedMessage> binary(const uint8_t* payload, size_t size) {
+        return create(Opcode::Binary, payload, size);
+    }
+
+    PreparedMessage(Private, Opcode opcode, const uint8_t* payload, size_t size, bool compressed);
+
+    /**
+     * @brief Retrieves the opcode of the message.
+     */
+    Opcode opcode() const noexcept { return _opcode; }
+
+    /**
+     * @brief Checks whether the payload is deflated.
+     */
+    bool compressed() const noexcept { return _compressed; }
+
+    /**
+     * @brief Retrieves the encoded frame, header followed by payload.
+     */
+    const uint8_t* data() const noexcept { return _frame.data(); }
+
+    /**
+     * @brief Retrieves the size of the encoded frame.
+     */
+    size_t size() const noexcept { return _frame.size(); }
+
+    /**
+     * @brief Retrieves the payload of the frame.
+     */
+    const uint8_t* payload() const noexcept { return _frame.data() + _headerSize; }
+
+    /**
+     * @brief Retrieves the size of the frame payload.
+     */
+    size_t payloadSize() const noexcept { return _frame.size() - _headerSize; }
+
+private:
+    const Opcode _opcode;
+    const bool _compressed;
+    size_t _headerSize = 0U;
+    std::vector<uint8_t> _frame;
+};
+
+inline std::shared_ptr<const PreparedMessage> PreparedMessage::create(Opcode opcode, const uint8_t* payload,
+                                                                      size_t size, bool compressed) {
+    if (!payload) {
+        size = 0U;
+    }
+    switch (opcode) {
+        case Opcode::Text:
+            if (!compressed && !Utf8Validator::isValid({reinterpret_cast<const char*>(payload), size})) {
+                return nullptr;
+            }
+            break;
+        case Opcode::Binary:
+            break;
+        case Opcode::Ping:
+        case Opcode::Pong:
+            if (compressed || size > FrameCodec::MaxControlPayloadSize) {
+                return nullptr;
+            }
+            break;
+        default:
+            return nullptr;
+    }
+    return std::make_shared<const PreparedMessage>(Private{}, opcode, payload, size, compressed);
+}
+
+inline PreparedMessage::PreparedMessage(Private, Opcode opcode, const uint8_t* payload,
+                                        size_t size, bool compressed)
+    : _opcode(opcode)
+    , _compressed(compressed)
+    , _frame(FrameCodec::headerSize(size, false) + size)
+{
+    _headerSize = FrameCodec::writeHeader(_frame.data(), opcode, true, size, nullptr, compressed);
+    if (payload && size) {
+        std::memcpy(_frame.data() + _headerSize, payload, size);
+    }
+}
+
+/**
+ * @brief Queues the prepared message to a set of endpoints.
+ *
+ * Each endpoint references the same shared buffer, so the cost scales with the number
+ * of endpoints and not with the number of endpoints × payload size.
+ *
+ * @param first The beginning of the range of endpoints, elements may be raw, unique or shared pointers.
+ * @param last The end of the range of endpoints.
+ * @param message The prepared message.
+ * @return The number of endpoints that accepted the message.
+ */
+template <class Iterator>
+inline size_t broadcast(Iterator first, Iterator last,
+                        const std::shared_ptr<const PreparedMessage>& message) {
+    size_t accepted = 0U;
+    if (message) {
+        for (; first != last; ++first) {
+            if (*first && (*first)->sendPrepared(message)) {
+                ++accepted;
+            }
+        }
+    }
+    return accepted;
+}
+
+} // namespace Websocket
@@ -0,0 +1,270 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketReconnect.h
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+namespace Websocket
+{
+
+/**
+ * @brief Process-wide cap on concurrent opening handshakes.
+ *
+ * Shared by all endpoints through `ReconnectPolicy::_handshakeLimiter`, so that thousands
+ * of endpoints dropped at once don't stampede the restarted server. An endpoint takes
+ * a slot before connecting and returns it once the handshake completes or fails,
+ * if no slot is available the attempt is postponed by another backoff delay.
+ * Postponed attempts are not counted against `ReconnectPolicy::_maxAttempts`, see `ReconnectSchedule`.
+ * All methods are thread-safe, methods are virtual to allow cross-process limiters.
+ */
+class HandshakeLimiter
+{
+public:
+    /**
+     * @brief Constructs the limiter.
+     *
+     * @param maxConcurrent Maximal number of simultaneous handshakes, 0 means no limit.
+     */
+    explicit HandshakeLimiter(uint32_t maxConcurrent) noexcept : _maxConcurrent(maxConcurrent) {}
+
+    /**
+     * @brief Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~HandshakeLimiter() = default;
+
+    /**
+     * @brief Takes a handshake slot if available.
+     *
+     * @return `true` if the slot was taken and must be returned by `release`, otherwise `false`.
+     */
+    virtual bool tryAcquire() noexcept {
+        auto active = _active.load(std::memory_order_relaxed);
+        do {
+            if (_maxConcurrent && active >= _maxConcurrent) {
+                return false;
+            }
+        }
+        while (!_active.compare_exchange_weak(active, active + 1U, std::memory_order_acquire,
+                                              std::memory_order_relaxed));
+        return true;
+    }
+
+    /**
+     * @brief Returns the handshake slot taken by `tryAcquire`.
+     */
+    virtual void release() noexcept { _active.fetch_sub(1U, std::memory_order_release); }
+
+    /**
+     * @brief Retrieves the number of handshakes in progress.
+     */
+    virtual uint32_t active() const noexcept { return _active.load(std::memory_order_relaxed); }
+
+private:
+    const uint32_t _maxConcurrent;
+    std::atomic<uint32_t> _active = 0U;
+};
+
+/**
+ * @brief Represents the policy of automatic reconnection.
+ *
+ * When the connection is lost without `EndPoint::close`, the endpoint re-opens it
+ * with the same `Options` and `connectionId` after an exponential backoff delay
+ * with full jitter, see `reconnectDelay`. The listener receives `State::Reconnecting`
+ * instead of `State::Disconnected`, followed by `State::Connecting` and `State::Connected`
+ * on resumption, or by `State::Disconnected` once attempts are exhausted.
+ * Each failed attempt is reported by `Listener::onError`.
+ */
+struct ReconnectPolicy
+{
+    /**
+     * @brief Maximal number of consecutive attempts, 0 means no limit.
+     *
+     * Only started handshakes are counted, waits for a slot of `_handshakeLimiter`
+     * don't consume attempts.
+     */
+    uint32_t _maxAttempts = 0U;
+
+    /**
+     * @brief The upper bound of the delay before the first attempt.
+     */
+    std::chrono::milliseconds _initialDelay = std::chrono::milliseconds(100);
+
+    /**
+     * @brief The upper bound of the delay of any attempt.
+     */
+    std::chrono::milliseconds _maxDelay = std::chrono::seconds(30);
+
+    /**
+     * @brief The growth factor of the delay bound after each failed attempt.
+     */
+    double _multiplier = 2.;
+
+    /**
+     * @brief Enables full jitter: the delay is uniformly random in [0, bound].
+     *
+     * Spreads attempts of simultaneously dropped endpoints over the whole interval,
+     * if disabled the delay equals the bound.
+     */
+    bool _jitter = true;
+
+    /**
+     * @brief The shared cap on concurrent handshakes, no cap if not specified.
+     */
+    std::shared_ptr<HandshakeLimiter> _handshakeLimiter;
+};
+
+/**
+ * @brief Calculates the delay before the reconnection attempt.
+ *
+ * Takes constant time for any [attempt], the exponent is clamped to the number
+ * of growth steps needed to reach `_maxDelay`.
+ *
+ * @param policy The reconnection policy.
+ * @param attempt Zero-based index of the attempt.
+ * @param generator A uniform random bit generator, e.g. `std::mt19937_64`.
+ * @return The delay, `min(_maxDelay, _initialDelay * _multiplier ^ attempt)`
+ *         or a uniformly random value below it if `_jitter` is set.
+ */
+template <class Generator>
+inline std::chrono::milliseconds reconnectDelay(const ReconnectPolicy& policy,
+                                                uint32_t attempt, Generator& generator) {
+    const double initialDelay = static_cast<double>(policy._initialDelay.count());
+    const double maxDelay = static_cast<double>(policy._maxDelay.count());
+    double bound = std::min(initialDelay, maxDelay);
+    if (bound > 0. && policy._multiplier > 1. && attempt > 0U) {
+        const double steps = std::ceil(std::log(maxDelay / bound) / std::log(policy._multiplier));
+        bound = std::min(maxDelay, bound * std::pow(policy._multiplier, std::min(static_cast<double>(attempt), steps)));
+    }
+    auto delay = static_cast<std::chrono::milliseconds::rep>(bound > 0. ? bound : 0.);
+    if (policy._jitter && delay > 0) {
+        delay = std::uniform_int_distribution<std::chrono::milliseconds::rep>(0, delay)(generator);
+    }
+    return std::chrono::milliseconds(delay);
+}
+
+/**
+ * @brief Reconnection state of a single endpoint, driven by its event loop.
+ *
+ * Implements the accounting of `ReconnectPolicy`: the endpoint waits for `nextDelay`,
+ * then calls `tryBegin`. If the handshake limiter has no free slot the attempt is postponed
+ * by another `nextDelay` of the same attempt index and doesn't count against
+ * `_maxAttempts`, otherwise the handshake starts and its outcome is reported by
+ * `onSucceeded` or `onFailed`. Not thread-safe, each endpoint owns its schedule.
+ */
+class ReconnectSchedule
+{
+public:
+    /**
+     * @brief Constructs the schedule.
+     *
+     * @param policy The reconnection policy.
+     * @param seed The seed of the jitter generator, distinct for each endpoint.
+     */
+    explicit ReconnectSchedule(ReconnectPolicy policy, uint64_t seed = std::random_device{}())
+        : _policy(std::move(policy))
+        , _generator(seed)
+    {
+    }
+
+    ReconnectSchedule(const ReconnectSchedule&) = delete;
+    ReconnectSchedule& operator = (const ReconnectSchedule&) = delete;
+
+    /**
+     * @brief Destructor, returns the handshake slot if a handshake is in progress.
+     */
+    ~ReconnectSchedule() { releaseSlot(); }
+
+    /**
+     * @brief Calculates the delay before the next call of `tryBegin`.
+     */
+    std::chrono::milliseconds nextDelay() { return reconnectDelay(_policy, _attempts, _generator); }
+
+    /**
+     * @brief Starts the attempt if a handshake slot is available.
+     *
+     * @return `true` if the handshake may start, the attempt is counted;
+     *         `false` if the attempt is postponed by the limiter or attempts are exhausted.
+     */
+    bool tryBegin() {
+        if (exhausted() || _inProgress) {
+            return false;
+        }
+        if (_policy._handshakeLimiter && !_policy._handshakeLimiter->tryAcquire()) {
+            ++_postponed;
+            return false;
+        }
+        _inProgress = true;
+        ++_attempts;
+        return true;
+    }
+
+    /**
+     * @brief Completes the attempt with the established connection, resets the backoff.
+     */
+    void onSucceeded() {
+        releaseSlot();
+        _attempts = 0U;
+    }
+
+    /**
+     * @brief Completes the attempt with a failure, the next delay grows.
+     */
+    void onFailed() { releaseSlot(); }
+
+    /**
+     * @brief Checks whether no more attempts are allowed by `ReconnectPolicy::_maxAttempts`.
+     */
+    bool exhausted() const noexcept {
+        return !_inProgress && _policy._maxAttempts && _attempts >= _policy._maxAttempts;
+    }
+
+    /**
+     * @brief Retrieves the number of started attempts since the last successful connection.
+     */
+    uint32_t attempts() const noexcept { return _attempts; }
+
+    /**
+     * @brief Retrieves the number of attempts postponed by the handshake limiter.
+     */
+    uint64_t postponed() const noexcept { return _postponed; }
+
+    /**
+     * @brief Checks whether the handshake of the current attempt is in progress.
+     */
+    bool inProgress() const noexcept { return _inProgress; }
+
+private:
+    void releaseSlot() noexcept {
+        if (_inProgress) {
+            _inProgress = false;
+            if (_policy._handshakeLimiter) {
+                _policy._handshakeLimiter->release();
+            }
+        }
+    }
+
+private:
+    const ReconnectPolicy _policy;
+    std::mt19937_64 _generator;
+    uint32_t _attempts = 0U;
+    uint64_t _postponed = 0U;
+    bool _inProgress = false;
+};
+
+} // namespace Websocket
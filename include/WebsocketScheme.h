@@ -0,0 +1,231 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketScheme.h
+#include <cctype>
+#include <string>
+#include <string_view>
+
+namespace Websocket
+{
+
+/**
+ * @brief Enum class representing transports of websocket connections, selected by the URL scheme.
+ */
+enum class Scheme
+{
+    /**
+     * @brief The scheme is missing or not recognized.
+     *
+     * Hosts without a scheme, e.g. `example.com:8080`, are resolved by implementations
+     * as before schemes were introduced, see `Factory::supportsScheme`.
+     */
+    Unknown,
+
+    /**
+     * @brief Plain websocket over TCP, `ws://host[:port]/resource`.
+     */
+    Ws,
+
+    /**
+     * @brief Websocket over TLS, `wss://host[:port]/resource`.
+     */
+    Wss,
+
+    /**
+     * @brief In-process transport, `inproc://name/resource`.
+     *
+     * Connects to the `Acceptor` of the same `Factory` started with
+     * `AcceptorOptions::_address` set to `inproc://name`. Messages are handed over
+     * to the peer without sockets, framing or masking, text and blobs are passed
+     * by reference and `EndPoint::sendSharedBinary` transfers buffers without copying.
+     * States, close codes and ping/pong behave the same as for network transports,
+     * socket, TLS and compression options are ignored.
+     */
+    InProcess,
+
+    /**
+     * @brief Plain websocket over a Unix domain stream socket, `ws+unix:///path/to/socket:/resource`.
+     *
+     * Connections to sidecars on the same host skip the TCP/IP stack, the `Host`
+     * header of the handshake is `localhost`. TCP-specific socket options are ignored.
+     * See `unixSocketPath` and `unixResource` for splitting of the URL.
+     */
+    Unix,
+
+    /**
+     * @brief Websocket over TLS over a Unix domain stream socket, `wss+unix:///path/to/socket:/resource`.
+     */
+    SecureUnix
+};
+
+/**
+ * @brief Retrieves the transport scheme of the URL, case-insensitive.
+ *
+ * @param url The URL of the connection, e.g. `Options::_host`.
+ * @return The `Scheme` of the URL, `Scheme::Unknown` if the URL has no known scheme.
+ */
+inline Scheme schemeOf(std::string_view url) {
+    const auto separator = url.find("://");
+    if (std::string_view::npos != separator) {
+        const auto name = url.substr(0U, separator);
+        const auto equals = [name](std::string_view other) {
+            if (name.size() != other.size()) {
+                return false;
+            }
+            for (size_t i = 0U; i < name.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(name[i])) != other[i]) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        if (equals("ws")) {
+            return Scheme::Ws;
+        }
+        if (equals("wss")) {
+            return Scheme::Wss;
+        }
+        if (equals("inproc")) {
+            return Scheme::InProcess;
+        }
+        if (equals("ws+unix")) {
+            return Scheme::Unix;
+        }
+        if (equals("wss+unix")) {
+            return Scheme::SecureUnix;
+        }
+    }
+    return Scheme::Unknown;
+}
+
+/**
+ * @brief Retrieves the name of the acceptor addressed by the `Scheme::InProcess` URL.
+ *
+ * @param url The URL of the connection, e.g. `inproc://name/stream`.
+ * @return The name of the acceptor (`name`), empty if the URL is not an in-process URL.
+ */
+inline std::string_view inProcessName(std::string_view url) {
+    if (Scheme::InProcess == schemeOf(url)) {
+        url.remove_prefix(url.find("://") + 3U);
+        return url.substr(0U, url.find('/'));
+    }
+    return {};
+}
+
+/**
+ * @brief Retrieves the requested resource of the `Scheme::InProcess` URL.
+ *
+ * @param url The URL of the connection, e.g. `inproc://name/stream`.
+ * @return The resource following the acceptor name (`/stream`), `/` if not specified.
+ */
+inline std::string_view inProcessResource(std::string_view url) {
+    if (Scheme::InProcess == schemeOf(url)) {
+        url.remove_prefix(url.find("://") + 3U);
+        const auto separator = url.find('/');
+        if (std::string_view::npos != separator) {
+            return url.substr(separator);
+        }
+    }
+    return "/";
+}
+
+/**
+ * @brief Checks whether the scheme denotes a transport over Unix domain sockets.
+ */
+constexpr bool isUnix(Scheme scheme) noexcept {
+    return Scheme::Unix == scheme || Scheme::SecureUnix == scheme;
+}
+
+/**
+ * @brief Retrieves the socket path of the `Scheme::Unix` or `Scheme::SecureUnix` URL.
+ *
+ * The path is terminated by the first `:/` that starts the resource, e.g. `/run/app.sock`
+ * for `ws+unix:///run/app.sock:/stream`, so paths may contain `:` elsewhere
+ * (`ws+unix:///run/a:b.sock:/stream`). Percent-encoded bytes are decoded, a path
+ * containing `:/` must be written with `%3A/`.
+ *
+ * @param url The URL of the connection.
+ * @return The decoded socket path, empty if the URL is not a Unix domain socket URL.
+ */
+inline std::string unixSocketPath(std::string_view url) {
+    std::string path;
+    if (isUnix(schemeOf(url))) {
+        url.remove_prefix(url.find("://") + 3U);
+        url = url.substr(0U, url.find(":/"));
+        if (!url.empty() && ':' == url.back()) {
+            url.remove_suffix(1U); // empty resource
+        }
+        const auto hex = [](char c) {
+            if (c >= '0' && c <= '9') {
+                return c - '0';
+            }
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+        };
+        path.reserve(url.size());
+        for (size_t i = 0U; i < url.size(); ++i) {
+            if ('%' == url[i] && i + 2U < url.size() && hex(url[i + 1U]) >= 0 && hex(url[i + 2U]) >= 0) {
+                path += static_cast<char>(hex(url[i + 1U]) * 16 + hex(url[i + 2U]));
+                i += 2U;
+            }
+            else {
+                path += url[i];
+            }
+        }
+    }
+    return path;
+}
+
+/**
+ * @brief Retrieves the requested resource of the `Scheme::Unix` or `Scheme::SecureUnix` URL.
+ *
+ * @param url The URL of the connection, e.g. `ws+unix:///run/app.sock:/stream`.
+ * @return The resource following the socket path (`/stream`), `/` if not specified.
+ */
+inline std::string_view unixResource(std::string_view url) {
+    if (isUnix(schemeOf(url))) {
+        url.remove_prefix(url.find("://") + 3U);
+        const auto separator = url.find(":/");
+        if (std::string_view::npos != separator) {
+            return url.substr(separator + 1U);
+        }
+    }
+    return "/";
+}
+
+/**
+ * @brief Converts a `Scheme` value to its string representation.
+ *
+ * @param scheme The `Scheme` enum value to convert.
+ * @return A constant character pointer, URL scheme without `://` separator.
+ */
+inline const char* toString(Scheme scheme) {
+    switch (scheme) {
+        case Scheme::Ws:
+            return "ws";
+        case Scheme::Wss:
+            return "wss";
+        case Scheme::InProcess:
+            return "inproc";
+        case Scheme::Unix:
+            return "ws+unix";
+        case Scheme::SecureUnix:
+            return "wss+unix";
+        default:
+            break;
+    }
+    return "unknown";
+}
+
+} // namespace Websocket
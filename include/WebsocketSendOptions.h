@@ -0,0 +1,74 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketSendOptions.h
+#include <cstdint>
+#include <optional>
+
+namespace Websocket
+{
+
+/**
+ * @brief Enum class representing modes of the outgoing messages queue.
+ */
+enum class SendQueue
+{
+    /**
+     * @brief Messages are written strictly in the order of sending.
+     *
+     * Priorities and conflation keys of `SendOptions` are ignored.
+     */
+    Fifo,
+
+    /**
+     * @brief Messages are written by priority, queued messages may be replaced.
+     *
+     * Messages with higher `SendPriority` are written first, messages of the same priority
+     * keep their order. A newer message with the same conflation key replaces the queued one,
+     * so that only the latest value is written under congestion.
+     */
+    Conflating
+};
+
+/**
+ * @brief Enum class representing priorities of outgoing messages.
+ *
+ * Control frames (ping, pong and close) always bypass the queue regardless of priority.
+ */
+enum class SendPriority
+{
+    Low,
+    Normal,
+    High
+};
+
+/**
+ * @brief Represents per-message options of the conflating send queue.
+ */
+struct SendOptions
+{
+    /**
+     * @brief The priority of the message.
+     */
+    SendPriority _priority = SendPriority::Normal;
+
+    /**
+     * @brief The conflation key of the message.
+     *
+     * If specified, the message replaces a not yet written message with the same key,
+     * for example the previous price tick of the same instrument.
+     */
+    std::optional<uint64_t> _conflationKey;
+};
+
+} // namespace Websocket
@@ -0,0 +1,143 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketSharding.h
+#include "WebsocketIoBackend.h"
+#include <cstdint>
+#include <vector>
+
+namespace Websocket
+{
+
+/**
+ * @brief Enum class representing policies of endpoints placement across event-loop shards.
+ *
+ * For all policies the shard is selected by the first `EndPoint::open` of the endpoint
+ * and stays fixed until the endpoint is destroyed: closing and reopening (even with
+ * another connection ID) and automatic reconnects never move the endpoint to another shard.
+ */
+enum class ShardPlacement
+{
+    /**
+     * @brief Endpoints are assigned to shards in turn.
+     */
+    RoundRobin,
+
+    /**
+     * @brief Endpoint is assigned to the shard with the least number of endpoints.
+     */
+    LeastLoaded,
+
+    /**
+     * @brief Endpoint is assigned by hash of the connection ID of its first `EndPoint::open`, see `shardOf`.
+     *
+     * Endpoints first opened with the same connection ID share a shard, which keeps
+     * related connections on the same core without cross-shard communication.
+     * Connection IDs passed to later `EndPoint::open` calls don't affect the placement.
+     */
+    ConnectionIdHash
+};
+
+/**
+ * @brief Represents configuration of sharded event loops.
+ *
+ * Event loops are shared by all endpoints of the factory, so their I/O mechanism
+ * is configured here rather than per endpoint.
+ * Applied by `Factory::setSharding` to factories that drive endpoints by several
+ * event-loop threads. Each endpoint lives on a single shard from its first `EndPoint::open`
+ * until destruction (see `ShardPlacement`), so the per-message path never takes
+ * cross-shard locks.
+ */
+struct ShardingOptions
+{
+    /**
+     * @brief The number of event-loop threads, 0 means the number of hardware threads.
+     */
+    uint32_t _shards = 0U;
+
+    /**
+     * @brief CPU indices to pin event-loop threads to, one per shard.
+     *
+     * Shard `i` is pinned to `_cpuAffinity[i % _cpuAffinity.size()]`, no pinning if empty.
+     */
+    std::vector<int> _cpuAffinity;
+
+    /**
+     * @brief The policy of endpoints placement.
+     */
+    ShardPlacement _placement = ShardPlacement::RoundRobin;
+
+    /**
+     * @brief The mechanism of socket I/O used by all event loops.
+     *
+     * `Factory::setSharding` rejects backends that are not supported (see `Factory::supports`),
+     * endpoints fail to open with `Failure::IoBackend` error if the backend can't be
+     * initialized at runtime.
+     */
+    IoBackend _ioBackend = IoBackend::Default;
+
+    /**
+     * @brief Tuning parameters of the `IoBackend::IoUring` backend, one ring per event loop.
+     */
+    IoUringOptions _ioUring;
+};
+
+/**
+ * @brief Represents a snapshot of a single shard load.
+ */
+struct ShardLoad
+{
+    /**
+     * @brief The CPU index the shard is pinned to, -1 if not pinned.
+     */
+    int _cpu = -1;
+
+    /**
+     * @brief The number of endpoints served by the shard.
+     */
+    uint64_t _endpoints = 0U;
+
+    /**
+     * @brief The number of messages received by endpoints of the shard.
+     */
+    uint64_t _messagesIn = 0U;
+
+    /**
+     * @brief The number of messages sent by endpoints of the shard.
+     */
+    uint64_t _messagesOut = 0U;
+
+    /**
+     * @brief The share of time the event loop was busy, in range [0, 1].
+     */
+    double _utilization = 0.;
+};
+
+/**
+ * @brief Calculates the shard for the connection ID under `ShardPlacement::ConnectionIdHash` policy.
+ *
+ * Uses the SplitMix64 finalizer, so sequential IDs are evenly spread across shards.
+ *
+ * @param connectionId The connection ID passed to the first `EndPoint::open` of the endpoint.
+ * @param shards The number of shards, must be greater than 0.
+ * @return The shard index in range [0, shards).
+ */
+inline uint32_t shardOf(uint64_t connectionId, uint32_t shards) noexcept {
+    uint64_t hash = connectionId + 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return static_cast<uint32_t>(hash % shards);
+}
+
+} // namespace Websocket
@@ -51,6 +51,14 @@ enum class State
      * This state indicates that the connection has been fully closed.
      */
     Disconnected,
+
+    /**
+     * @brief The connection was lost and will be re-opened automatically.
+     *
+     * This state is reported instead of `Disconnected` if `Options::_reconnect`
+     * is specified, see `ReconnectPolicy`.
+     */
+    Reconnecting,
 };
 
 
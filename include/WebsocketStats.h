@@ -0,0 +1,410 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketStats.h
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Websocket
+{
+
+/**
+ * @brief Histogram of durations with power-of-two buckets.
+ *
+ * Bucket 0 counts samples below 1 microsecond, bucket `i` counts samples
+ * in range [2^(i-1), 2^i) microseconds, the last bucket counts all longer samples.
+ */
+struct LatencyHistogram
+{
+    /**
+     * @brief The number of buckets, covers durations up to ~35 minutes.
+     */
+    static constexpr size_t Buckets = 32U;
+
+    /**
+     * @brief Calculates the bucket of the duration.
+     *
+     * @param duration The duration of the sample.
+     * @return The bucket index in range [0, Buckets).
+     */
+    static size_t bucketOf(std::chrono::microseconds duration) noexcept {
+        auto value = static_cast<uint64_t>(std::max<int64_t>(0, duration.count()));
+        size_t bucket = 0U;
+        for (; value && bucket + 1U < Buckets; value >>= 1U) {
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    /**
+     * @brief Retrieves the upper bound of the bucket.
+     *
+     * @param bucket The bucket index.
+     * @return The exclusive upper bound of bucket durations.
+     */
+    static std::chrono::microseconds upperBound(size_t bucket) noexcept {
+        return std::chrono::microseconds(int64_t(1) << bucket);
+    }
+
+    /**
+     * @brief Adds the sample to the histogram.
+     *
+     * @param duration The duration of the sample.
+     */
+    void add(std::chrono::microseconds duration) noexcept {
+        ++_counts[bucketOf(duration)];
+        _sum += duration;
+    }
+
+    /**
+     * @brief Retrieves the total number of samples.
+     */
+    uint64_t count() const noexcept {
+        uint64_t count = 0U;
+        for (const auto bucketCount : _counts) {
+            count += bucketCount;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Estimates the percentile of samples.
+     *
+     * @param percentile The percentile in range [0, 100].
+     * @return The upper bound of the bucket containing the percentile, 0 if there are no samples.
+     */
+    std::chrono::microseconds percentile(double percentile) const noexcept {
+        const auto total = count();
+        if (0U == total) {
+            return {};
+        }
+        const auto exactRank = static_cast<double>(total) * percentile / 100.;
+        const auto rank = std::max<uint64_t>(1U, static_cast<uint64_t>(exactRank + 0.5));
+        uint64_t accumulated = 0U;
+        for (size_t bucket = 0U; bucket < Buckets; ++bucket) {
+            accumulated += _counts[bucket];
+            if (accumulated >= rank) {
+                return upperBound(bucket);
+            }
+        }
+        return upperBound(Buckets - 1U);
+    }
+
+    /**
+     * @brief Merges samples of another histogram.
+     */
+    LatencyHistogram& operator += (const LatencyHistogram& other) noexcept {
+        for (size_t bucket = 0U; bucket < Buckets; ++bucket) {
+            _counts[bucket] += other._counts[bucket];
+        }
+        _sum += other._sum;
+        return *this;
+    }
+
+    /**
+     * @brief The number of samples in each bucket.
+     */
+    std::array<uint64_t, Buckets> _counts = {};
+
+    /**
+     * @brief The sum of all sample durations.
+     */
+    std::chrono::microseconds _sum = {};
+};
+
+/**
+ * @brief Represents a snapshot of endpoint performance statistics.
+ *
+ * Snapshots of several endpoints can be merged by `operator +=` into an aggregate.
+ */
+struct Stats
+{
+    /**
+     * @brief The number of bytes received from the socket.
+     */
+    uint64_t _bytesIn = 0U;
+
+    /**
+     * @brief The number of bytes written to the socket.
+     */
+    uint64_t _bytesOut = 0U;
+
+    /**
+     * @brief The number of received frames, including control frames.
+     */
+    uint64_t _framesIn = 0U;
+
+    /**
+     * @brief The number of sent frames, including control frames.
+     */
+    uint64_t _framesOut = 0U;
+
+    /**
+     * @brief The current number of messages in the send queue.
+     */
+    uint64_t _sendQueueDepth = 0U;
+
+    /**
+     * @brief The maximal number of messages ever observed in the send queue.
+     */
+    uint64_t _sendQueueHighWaterMark = 0U;
+
+    /**
+     * @brief The number of messages rejected or dropped by the send path.
+     *
+     * Includes sends rejected by the high watermark, by a full queue and replaced by conflation.
+     */
+    uint64_t _droppedSends = 0U;
+
+    /**
+     * @brief Durations of opening handshakes (TCP, TLS and HTTP upgrade).
+     */
+    LatencyHistogram _handshakeDuration;
+
+    /**
+     * @brief Round-trip times of ping/pong exchanges.
+     */
+    LatencyHistogram _pingRtt;
+
+    /**
+     * @brief Merges another snapshot into the aggregate.
+     *
+     * Counters and queue depths are summed, the high-water mark is the maximal one.
+     */
+    Stats& operator += (const Stats& other) noexcept {
+        _bytesIn += other._bytesIn;
+        _bytesOut += other._bytesOut;
+        _framesIn += other._framesIn;
+        _framesOut += other._framesOut;
+        _sendQueueDepth += other._sendQueueDepth;
+        _sendQueueHighWaterMark = std::max(_sendQueueHighWaterMark, other._sendQueueHighWaterMark);
+        _droppedSends += other._droppedSends;
+        _handshakeDuration += other._handshakeDuration;
+        _pingRtt += other._pingRtt;
+        return *this;
+    }
+};
+
+/**
+ * @brief Hot-path counters of endpoint statistics.
+ *
+ * All updates are relaxed atomic operations on the counters of a single endpoint,
+ * so collecting costs almost nothing; `snapshot` may be called from any thread.
+ */
+class StatsCounters
+{
+public:
+    void addBytesIn(uint64_t bytes) noexcept { add(_bytesIn, bytes); }
+    void addBytesOut(uint64_t bytes) noexcept { add(_bytesOut, bytes); }
+    void addFramesIn(uint64_t frames = 1U) noexcept { add(_framesIn, frames); }
+    void addFramesOut(uint64_t frames = 1U) noexcept { add(_framesOut, frames); }
+    void addDroppedSends(uint64_t sends = 1U) noexcept { add(_droppedSends, sends); }
+
+    /**
+     * @brief Updates the send queue depth and its high-water mark.
+     *
+     * @param depth The current number of messages in the send queue.
+     */
+    void setSendQueueDepth(uint64_t depth) noexcept {
+        _sendQueueDepth.store(depth, std::memory_order_relaxed);
+        auto highWaterMark = _sendQueueHighWaterMark.load(std::memory_order_relaxed);
+        while (depth > highWaterMark &&
+               !_sendQueueHighWaterMark.compare_exchange_weak(highWaterMark, depth,
+                                                              std::memory_order_relaxed)) {}
+    }
+
+    void addHandshakeDuration(std::chrono::microseconds duration) noexcept { add(_handshakeDuration, duration); }
+    void addPingRtt(std::chrono::microseconds rtt) noexcept { add(_pingRtt, rtt); }
+
+    /**
+     * @brief Takes a consistent enough snapshot of counters.
+     *
+     * @return The snapshot, individual counters are read atomically but not all at once.
+     */
+    Stats snapshot() const noexcept {
+        Stats stats;
+        stats._bytesIn = load(_bytesIn);
+        stats._bytesOut = load(_bytesOut);
+        stats._framesIn = load(_framesIn);
+        stats._framesOut = load(_framesOut);
+        stats._sendQueueDepth = load(_sendQueueDepth);
+        stats._sendQueueHighWaterMark = load(_sendQueueHighWaterMark);
+        stats._droppedSends = load(_droppedSends);
+        stats._handshakeDuration = load(_handshakeDuration);
+        stats._pingRtt = load(_pingRtt);
+        return stats;
+    }
+
+private:
+    struct AtomicHistogram
+    {
+        std::array<std::atomic<uint64_t>, LatencyHistogram::Buckets> _counts = {};
+        std::atomic<int64_t> _sum = 0;
+    };
+    static void add(std::atomic<uint64_t>& counter, uint64_t value) noexcept {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+    static void add(AtomicHistogram& histogram, std::chrono::microseconds duration) noexcept {
+        add(histogram._counts[LatencyHistogram::bucketOf(duration)], 1U);
+        histogram._sum.fetch_add(duration.count(), std::memory_order_relaxed);
+    }
+    static uint64_t load(const std::atomic<uint64_t>& counter) noexcept {
+        return counter.load(std::memory_order_relaxed);
+    }
+    static LatencyHistogram load(const AtomicHistogram& histogram) noexcept {
+        LatencyHistogram result;
+        for (size_t bucket = 0U; bucket < LatencyHistogram::Buckets; ++bucket) {
+            result._counts[bucket] = load(histogram._counts[bucket]);
+        }
+        result._sum = std::chrono::microseconds(histogram._sum.load(std::memory_order_relaxed));
+        return result;
+    }
+
+private:
+    static constexpr size_t CacheLineSize = 64U;
+    // inbound counters are updated by the reading thread, outbound ones by senders,
+    // the groups are kept on separate cache lines to avoid false sharing
+    alignas(CacheLineSize) std::atomic<uint64_t> _bytesIn = 0U;
+    std::atomic<uint64_t> _framesIn = 0U;
+    alignas(CacheLineSize) std::atomic<uint64_t> _bytesOut = 0U;
+    std::atomic<uint64_t> _framesOut = 0U;
+    std::atomic<uint64_t> _sendQueueDepth = 0U;
+    std::atomic<uint64_t> _sendQueueHighWaterMark = 0U;
+    std::atomic<uint64_t> _droppedSends = 0U;
+    alignas(CacheLineSize) AtomicHistogram _handshakeDuration;
+    AtomicHistogram _pingRtt;
+};
+
+/**
+ * @brief Represents statistics of a single series for the Prometheus export.
+ */
+struct LabeledStats
+{
+    /**
+     * @brief Labels added to each sample of the series, e.g. `host="example.com"`.
+     */
+    std::string _labels;
+
+    /**
+     * @brief The statistics snapshot, of a single endpoint or an aggregate.
+     */
+    Stats _stats;
+};
+
+/**
+ * @brief Formats statistics of several series in the Prometheus text exposition format.
+ *
+ * Each metric family is described by `# HELP` and `# TYPE` lines once, followed by samples
+ * of all series, so the output of a single call is a valid exposition. Numbers are formatted
+ * independently of the global locale, durations in seconds are exact (microsecond resolution).
+ *
+ * @param series The statistics with distinct labels, e.g. one entry per host.
+ * @return A `std::string` with metrics named with `websocket_` prefix.
+ * @see https://prometheus.io/docs/instrumenting/exposition_formats/
+ */
+inline std::string toPrometheus(const std::vector<LabeledStats>& series) {
+    std::ostringstream os;
+    os.imbue(std::locale::classic());
+    // exact decimal representation of microseconds in seconds, e.g. "0.000512"
+    const auto seconds = [](std::chrono::microseconds duration) {
+        const auto count = duration.count();
+        const auto magnitude = count < 0 ? 0U - static_cast<uint64_t>(count) : static_cast<uint64_t>(count);
+        std::string value = (count < 0 ? "-" : "") + std::to_string(magnitude / 1000000U);
+        if (const auto fraction = magnitude % 1000000U) {
+            auto digits = std::to_string(fraction + 1000000U).substr(1U);
+            digits.erase(digits.find_last_not_of('0') + 1U);
+            value += '.' + digits;
+        }
+        return value;
+    };
+    const auto sample = [&os](std::string_view name, std::string_view labels, const auto& value,
+                              std::string_view extraLabel = {}) {
+        os << name;
+        if (!labels.empty() || !extraLabel.empty()) {
+            os << '{' << labels;
+            if (!labels.empty() && !extraLabel.empty()) {
+                os << ',';
+            }
+            os << extraLabel << '}';
+        }
+        os << ' ' << value << '\n';
+    };
+    const auto family = [&os](std::string_view name, std::string_view type, std::string_view help) {
+        os << "# HELP " << name << ' ' << help << '\n';
+        os << "# TYPE " << name << ' ' << type << '\n';
+    };
+    const auto scalar = [&](std::string_view name, std::string_view type,
+                            std::string_view help, uint64_t Stats::* field) {
+        family(name, type, help);
+        for (const auto& labeled : series) {
+            sample(name, labeled._labels, labeled._stats.*field);
+        }
+    };
+    const auto histogramFamily = [&](const std::string& name, std::string_view help,
+                                     LatencyHistogram Stats::* field) {
+        family(name, "histogram", help);
+        for (const auto& labeled : series) {
+            const auto& values = labeled._stats.*field;
+            uint64_t accumulated = 0U;
+            for (size_t bucket = 0U; bucket + 1U < LatencyHistogram::Buckets; ++bucket) {
+                accumulated += values._counts[bucket];
+                // `le` is inclusive, bounds of buckets are exclusive & samples are whole microseconds
+                const auto bound = LatencyHistogram::upperBound(bucket) - std::chrono::microseconds(1);
+                const auto le = "le=\"" + seconds(bound) + '"';
+                sample(name + "_bucket", labeled._labels, accumulated, le);
+            }
+            accumulated += values._counts.back();
+            sample(name + "_bucket", labeled._labels, accumulated, "le=\"+Inf\"");
+            sample(name + "_sum", labeled._labels, seconds(values._sum));
+            sample(name + "_count", labeled._labels, accumulated);
+        }
+    };
+    scalar("websocket_received_bytes_total", "counter", "Bytes received from the socket.", &Stats::_bytesIn);
+    scalar("websocket_sent_bytes_total", "counter", "Bytes written to the socket.", &Stats::_bytesOut);
+    scalar("websocket_received_frames_total", "counter", "Frames received.", &Stats::_framesIn);
+    scalar("websocket_sent_frames_total", "counter", "Frames sent.", &Stats::_framesOut);
+    scalar("websocket_send_queue_depth", "gauge", "Messages in the send queue.", &Stats::_sendQueueDepth);
+    scalar("websocket_send_queue_high_water_mark", "gauge", "Maximal number of messages in the send queue.",
+           &Stats::_sendQueueHighWaterMark);
+    scalar("websocket_dropped_sends_total", "counter", "Messages rejected or dropped by the send path.",
+           &Stats::_droppedSends);
+    histogramFamily("websocket_handshake_duration_seconds", "Duration of opening handshakes.",
+                    &Stats::_handshakeDuration);
+    histogramFamily("websocket_ping_rtt_seconds", "Round-trip time of ping/pong exchanges.", &Stats::_pingRtt);
+    return os.str();
+}
+
+/**
+ * @brief Formats the statistics in the Prometheus text exposition format.
+ *
+ * Produces a complete exposition with family descriptions, use the overload for
+ * a collection of series to export several label sets in one scrape.
+ *
+ * @param stats The statistics snapshot, of a single endpoint or an aggregate.
+ * @param labels Optional labels added to each sample, e.g. `host="example.com"`.
+ * @return A `std::string` with metrics named with `websocket_` prefix.
+ * @see https://prometheus.io/docs/instrumenting/exposition_formats/
+ */
+inline std::string toPrometheus(const Stats& stats, std::string_view labels = {}) {
+    return toPrometheus(std::vector<LabeledStats>{{std::string(labels), stats}});
+}
+
+} // namespace Websocket
@@ -0,0 +1,270 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketTimerWheel.h
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Websocket
+{
+
+/**
+ * @brief Hierarchical timing wheel shared by many endpoints.
+ *
+ * The `TimerWheel` class drives heartbeats and idle timeouts of all endpoints of an event loop.
+ * Scheduling, rescheduling and cancelling are O(1) and never allocate, since timers are
+ * intrusive nodes embedded into their owners. The wheel has 4 levels of 256 slots,
+ * covering 2^32 ticks, longer delays are clamped.
+ * The wheel is not thread-safe and should be owned by a single event-loop thread.
+ */
+class TimerWheel
+{
+    static constexpr size_t LevelBits = 8U;
+    static constexpr size_t Slots = size_t(1) << LevelBits;
+    static constexpr size_t Levels = 4U;
+
+    struct Node
+    {
+        Node* _prev = this;
+        Node* _next = this;
+        bool linked() const noexcept { return _next != this; }
+        void unlink() noexcept {
+            _prev->_next = _next;
+            _next->_prev = _prev;
+            _prev = _next = this;
+        }
+        void append(Node& node) noexcept {
+            node._prev = _prev;
+            node._next = this;
+            _prev->_next = &node;
+            _prev = &node;
+        }
+    };
+
+public:
+    /**
+     * @brief Base class of timers, to be embedded into owners (e.g. per-connection state).
+     *
+     * The timer is cancelled automatically on destruction.
+     */
+    class Timer : private Node
+    {
+        friend class TimerWheel;
+
+    public:
+        Timer() = default;
+        Timer(const Timer&) = delete;
+        Timer& operator = (const Timer&) = delete;
+        virtual ~Timer() { cancel(); }
+
+        /**
+         * @brief Checks whether the timer is scheduled.
+         */
+        bool scheduled() const noexcept { return linked(); }
+
+        /**
+         * @brief Cancels the timer if it is scheduled.
+         */
+        void cancel() noexcept;
+
+    protected:
+        /**
+         * @brief Called by `TimerWheel::advance` when the timer expires.
+         *
+         * The timer is not scheduled anymore at this moment and may be rescheduled from the callback.
+         */
+        virtual void onTimer() = 0;
+
+    private:
+        TimerWheel* _wheel = nullptr;
+        uint64_t _deadline = 0U;
+        size_t _level = 0U;
+    };
+
+    /**
+     * @brief Constructs the wheel.
+     *
+     * @param tick The resolution of the wheel, delays are rounded up to whole ticks.
+     * @param start The time point corresponding to the tick 0.
+     */
+    explicit TimerWheel(std::chrono::microseconds tick = std::chrono::milliseconds(10),
+                        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now()) noexcept;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator = (const TimerWheel&) = delete;
+    ~TimerWheel();
+
+    /**
+     * @brief Schedules the timer, reschedules it if the timer is already scheduled.
+     *
+     * @param timer The timer, must outlive the wheel or be destroyed before it.
+     * @param delay The delay relative to the current tick, at least one tick.
+     */
+    void schedule(Timer& timer, std::chrono::microseconds delay) noexcept;
+
+    /**
+     * @brief Advances the wheel up to the time point and fires expired timers.
+     *
+     * Ticks without timers due are skipped at once, so the cost depends on the number
+     * of timers rather than on the elapsed time.
+     *
+     * @param now The current time.
+     * @return The number of fired timers.
+     */
+    size_t advance(std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Retrieves the number of scheduled timers.
+     */
+    size_t size() const noexcept { return _size; }
+
+private:
+    void insert(Timer& timer) noexcept;
+    void cascade(size_t level) noexcept;
+    size_t fire();
+
+private:
+    const std::chrono::microseconds _tick;
+    const std::chrono::steady_clock::time_point _start;
+    uint64_t _current = 0U;
+    size_t _size = 0U;
+    // number of scheduled timers of each level
+    std::array<size_t, Levels> _levelSizes = {};
+    std::array<std::array<Node, Slots>, Levels> _slots;
+};
+
+inline void TimerWheel::Timer::cancel() noexcept {
+    if (linked()) {
+        unlink();
+        --_wheel->_size;
+        --_wheel->_levelSizes[_level];
+    }
+}
+
+inline TimerWheel::TimerWheel(std::chrono::microseconds tick,
+                              std::chrono::steady_clock::time_point start) noexcept
+    : _tick(tick.count() > 0 ? tick : std::chrono::microseconds(1))
+    , _start(start)
+{
+}
+
+inline TimerWheel::~TimerWheel() {
+    for (auto& level : _slots) {
+        for (auto& slot : level) {
+            while (slot.linked()) {
+                static_cast<Timer*>(slot._next)->cancel();
+            }
+        }
+    }
+}
+
+inline void TimerWheel::schedule(Timer& timer, std::chrono::microseconds delay) noexcept {
+    timer.cancel();
+    constexpr uint64_t maxTicks = (uint64_t(1) << (LevelBits * Levels)) - 1U;
+    uint64_t ticks = 0U;
+    if (delay.count() > 0) {
+        // rounded up without overflow of long delays
+        ticks = static_cast<uint64_t>(delay.count() / _tick.count()) + (0 != delay.count() % _tick.count() ? 1U : 0U);
+    }
+    ticks = ticks < 1U ? 1U : (ticks > maxTicks ? maxTicks : ticks);
+    timer._wheel = this;
+    timer._deadline = _current + ticks;
+    insert(timer);
+    ++_size;
+}
+
+inline size_t TimerWheel::advance(std::chrono::steady_clock::time_point now) {
+    if (now <= _start) {
+        return 0U;
+    }
+    const auto target = static_cast<uint64_t>((now - _start) / _tick);
+    size_t fired = 0U;
+    while (_current < target) {
+        if (0U == _size) {
+            _current = target; // nothing to fire, skip idle ticks at once
+            break;
+        }
+        // lower levels without timers have nothing to fire or cascade until they wrap around
+        size_t lowest = 0U;
+        while (lowest + 1U < Levels && 0U == _levelSizes[lowest]) {
+            ++lowest;
+        }
+        const uint64_t next = (((_current >> (LevelBits * lowest)) + 1U) << (LevelBits * lowest));
+        if (next > target) {
+            _current = target;
+            break;
+        }
+        _current = next;
+        for (size_t level = 1U; level < Levels; ++level) {
+            // cascade higher level each time lower levels wrap around
+            if (0U != (_current & ((uint64_t(1) << (LevelBits * level)) - 1U))) {
+                break;
+            }
+            cascade(level);
+        }
+        fired += fire();
+    }
+    return fired;
+}
+
+inline void TimerWheel::insert(Timer& timer) noexcept {
+    const uint64_t delta = timer._deadline - _current;
+    size_t level = 0U;
+    while (level + 1U < Levels && delta >= (uint64_t(1) << (LevelBits * (level + 1U)))) {
+        ++level;
+    }
+    const auto slot = static_cast<size_t>((timer._deadline >> (LevelBits * level)) & (Slots - 1U));
+    _slots[level][slot].append(timer);
+    timer._level = level;
+    ++_levelSizes[level];
+}
+
+inline void TimerWheel::cascade(size_t level) noexcept {
+    auto& slot = _slots[level][(_current >> (LevelBits * level)) & (Slots - 1U)];
+    Node pending;
+    while (slot.linked()) {
+        auto node = slot._next;
+        node->unlink();
+        pending.append(*node);
+    }
+    while (pending.linked()) {
+        auto timer = static_cast<Timer*>(pending._next);
+        timer->unlink();
+        --_levelSizes[level];
+        insert(*timer);
+    }
+}
+
+inline size_t TimerWheel::fire() {
+    auto& slot = _slots[0][_current & (Slots - 1U)];
+    Node expired;
+    while (slot.linked()) {
+        auto node = slot._next;
+        node->unlink();
+        expired.append(*node);
+    }
+    size_t fired = 0U;
+    while (expired.linked()) {
+        auto timer = static_cast<Timer*>(expired._next);
+        timer->unlink();
+        --_size;
+        --_levelSizes[0];
+        ++fired;
+        timer->onTimer();
+    }
+    return fired;
+}
+
+} // namespace Websocket
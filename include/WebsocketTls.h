@@ -14,11 +14,14 @@
 #pragma once
 #include "WebsocketTlsPeerVerification.h"
 #include "WebsocketTlsMethod.h"
+#include <memory>
 #include <string>
 
 namespace Websocket
 {
 
+class TlsSessionCache;
+
 /**
  * @brief Represents the configuration for TLS (Transport Layer Security) settings.
  *
@@ -145,6 +148,22 @@ struct Tls
      * Specifies custom Diffie-Hellman parameters to be used for key exchange.
      */
     std::string _dh;
+
+    /**
+     * @brief Shared cache of TLS sessions for resumption.
+     *
+     * If specified, sessions are reused on reconnection to the same host with the same
+     * TLS configuration, so that the full handshake is skipped; `nullptr` disables resumption.
+     */
+    std::shared_ptr<TlsSessionCache> _sessionCache;
+
+    /**
+     * @brief Enable stateless session tickets.
+     *
+     * If true, TLS 1.2 session tickets (RFC 5077) are requested in addition to session IDs,
+     * TLS 1.3 always uses tickets (PSK) for resumption.
+     */
+    bool _sessionTickets = true;
 };
 
 } // namespace Websocket
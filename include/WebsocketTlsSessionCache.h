@@ -0,0 +1,278 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketTlsSessionCache.h
+#include "WebsocketTls.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Websocket
+{
+
+/**
+ * @brief Represents a snapshot of the TLS session cache statistics.
+ */
+struct TlsSessionCacheStats
+{
+    /**
+     * @brief The number of handshakes completed without session resumption.
+     */
+    uint64_t _fullHandshakes = 0U;
+
+    /**
+     * @brief The number of handshakes completed by resumption of a cached session.
+     */
+    uint64_t _resumedHandshakes = 0U;
+
+    /**
+     * @brief Calculates the ratio of resumed handshakes.
+     *
+     * @return The resumption rate in range [0, 1].
+     */
+    double resumptionRate() const noexcept {
+        const auto total = _fullHandshakes + _resumedHandshakes;
+        return total ? static_cast<double>(_resumedHandshakes) / static_cast<double>(total) : 0.;
+    }
+};
+
+/**
+ * @brief In-process cache of TLS sessions, shared between endpoints.
+ *
+ * Endpoints store serialized sessions (TLS 1.2 session IDs/tickets, TLS 1.3 PSK tickets)
+ * after the handshake and offer them on reconnection to the same host with the same
+ * TLS configuration, so that reconnects skip the full handshake.
+ * TLS 1.3 tickets are single-use (RFC 8446, appendix C.4): servers issue several tickets per
+ * connection, the cache keeps a bounded queue of them per key and `take` hands each session
+ * out only once, endpoints store sessions received after the resumed handshake again.
+ * When the cache is full the least recently used key loses its oldest session.
+ * All methods are thread-safe, methods are virtual to allow external storage.
+ */
+class TlsSessionCache
+{
+public:
+    /**
+     * @brief Constructs the cache.
+     *
+     * @param maxEntries Maximal number of cached sessions of all keys, 0 means no limit.
+     * @param maxSessionsPerKey Maximal number of cached sessions per key, 0 means no limit,
+     *                          the oldest session of the key is dropped when the limit is reached.
+     */
+    explicit TlsSessionCache(size_t maxEntries = 1024U, size_t maxSessionsPerKey = 4U)
+        : _maxEntries(maxEntries)
+        , _maxSessionsPerKey(maxSessionsPerKey)
+    {
+    }
+
+    /**
+     * @brief Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~TlsSessionCache() = default;
+
+    /**
+     * @brief Adds the session to the queue of the key.
+     *
+     * @param key The cache key, see `sessionKey`.
+     * @param session The serialized session, as produced by the TLS backend (e.g. `i2d_SSL_SESSION`).
+     */
+    virtual void store(const std::string& key, std::vector<uint8_t> session);
+
+    /**
+     * @brief Retrieves the most recently stored session of the key and removes it from the cache.
+     *
+     * @param key The cache key, see `sessionKey`.
+     * @return The serialized session or an empty vector if there is no session for the key.
+     */
+    virtual std::vector<uint8_t> take(const std::string& key);
+
+    /**
+     * @brief Removes all sessions of the key, for example if the server has rejected resumption.
+     *
+     * @param key The cache key, see `sessionKey`.
+     */
+    virtual void remove(const std::string& key);
+
+    /**
+     * @brief Retrieves the number of cached sessions of all keys.
+     *
+     * @return The number of sessions.
+     */
+    virtual size_t size() const;
+
+    /**
+     * @brief Reports the completed handshake, for statistics.
+     *
+     * @param resumed `true` if the handshake resumed a cached session.
+     */
+    virtual void reportHandshake(bool resumed) noexcept;
+
+    /**
+     * @brief Retrieves the cache statistics.
+     *
+     * @return A snapshot of the numbers of full and resumed handshakes.
+     */
+    virtual TlsSessionCacheStats stats() const noexcept;
+
+    /**
+     * @brief Builds the cache key for the host and TLS configuration.
+     *
+     * Sessions are never shared between different hosts or TLS configurations
+     * (certificates, trust store, ciphers or enabled protocol versions), fields are
+     * separated and strings (including the host) are prefixed by their lengths, so
+     * distinct hosts and configurations never produce the same key.
+     *
+     * @param host The host of the connection.
+     * @param tls The TLS configuration of the connection.
+     * @return A `std::string` key.
+     */
+    static std::string sessionKey(std::string_view host, const Tls& tls);
+
+private:
+    struct Entry
+    {
+        std::string _key;
+        // from the oldest to the most recent
+        std::deque<std::vector<uint8_t>> _sessions;
+    };
+    // from the most to the least recently used
+    using Entries = std::list<Entry>;
+
+private:
+    void touch(Entries::iterator entry);
+    void evictLeastRecentlyUsed();
+
+private:
+    const size_t _maxEntries;
+    const size_t _maxSessionsPerKey;
+    mutable std::mutex _mutex;
+    Entries _entries;
+    std::unordered_map<std::string_view, Entries::iterator> _index;
+    size_t _size = 0U;
+    std::atomic<uint64_t> _fullHandshakes = 0U;
+    std::atomic<uint64_t> _resumedHandshakes = 0U;
+};
+
+inline void TlsSessionCache::store(const std::string& key, std::vector<uint8_t> session) {
+    if (!session.empty()) {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _index.find(key);
+        if (it == _index.end()) {
+            _entries.push_front({key, {}});
+            it = _index.emplace(_entries.front()._key, _entries.begin()).first;
+        }
+        else {
+            touch(it->second);
+        }
+        auto& sessions = it->second->_sessions;
+        if (_maxSessionsPerKey && sessions.size() >= _maxSessionsPerKey) {
+            sessions.pop_front();
+            --_size;
+        }
+        sessions.push_back(std::move(session));
+        ++_size;
+        while (_maxEntries && _size > _maxEntries) {
+            evictLeastRecentlyUsed();
+        }
+    }
+}
+
+inline std::vector<uint8_t> TlsSessionCache::take(const std::string& key) {
+    std::vector<uint8_t> session;
+    const std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _index.find(key);
+    if (it != _index.end()) {
+        const auto entry = it->second;
+        session = std::move(entry->_sessions.back());
+        entry->_sessions.pop_back();
+        --_size;
+        if (entry->_sessions.empty()) {
+            _index.erase(it);
+            _entries.erase(entry);
+        }
+        else {
+            touch(entry);
+        }
+    }
+    return session;
+}
+
+inline void TlsSessionCache::remove(const std::string& key) {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _index.find(key);
+    if (it != _index.end()) {
+        const auto entry = it->second;
+        _size -= entry->_sessions.size();
+        _index.erase(it);
+        _entries.erase(entry);
+    }
+}
+
+inline size_t TlsSessionCache::size() const {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    return _size;
+}
+
+inline void TlsSessionCache::reportHandshake(bool resumed) noexcept {
+    (resumed ? _resumedHandshakes : _fullHandshakes).fetch_add(1U, std::memory_order_relaxed);
+}
+
+inline TlsSessionCacheStats TlsSessionCache::stats() const noexcept {
+    TlsSessionCacheStats stats;
+    stats._fullHandshakes = _fullHandshakes.load(std::memory_order_relaxed);
+    stats._resumedHandshakes = _resumedHandshakes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+inline std::string TlsSessionCache::sessionKey(std::string_view host, const Tls& tls) {
+    std::string key = std::to_string(host.size());
+    key += ':';
+    key += host;
+    key += '|';
+    key += std::to_string(static_cast<int>(tls._method));
+    key += '|';
+    key += std::to_string(static_cast<int>(tls._peerVerification));
+    key += '|';
+    for (const bool flag : {tls._sslv2No, tls._sslv3No, tls._tlsv1No,
+                            tls._tlsv1_1No, tls._tlsv1_2No, tls._tlsv1_3No}) {
+        key += flag ? '1' : '0';
+    }
+    for (const auto* value : {&tls._certificate, &tls._trustStore, &tls._sslCiphers}) {
+        key += '|';
+        key += std::to_string(value->size());
+        key += ':';
+        key += *value;
+    }
+    return key;
+}
+
+inline void TlsSessionCache::touch(Entries::iterator entry) {
+    _entries.splice(_entries.begin(), _entries, entry);
+}
+
+inline void TlsSessionCache::evictLeastRecentlyUsed() {
+    auto& entry = _entries.back();
+    entry._sessions.pop_front();
+    --_size;
+    if (entry._sessions.empty()) {
+        _index.erase(entry._key);
+        _entries.pop_back();
+    }
+}
+
+} // namespace Websocket
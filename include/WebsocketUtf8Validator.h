@@ -0,0 +1,479 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WebsocketUtf8Validator.h
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WEBSOCKET_UTF8_VALIDATOR_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define WEBSOCKET_UTF8_VALIDATOR_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(__AVX2__)
+#define WEBSOCKET_UTF8_VALIDATOR_AVX2
+#define WEBSOCKET_UTF8_VALIDATOR_SSSE3
+#include <immintrin.h>
+#elif defined(WEBSOCKET_UTF8_VALIDATOR_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+      (defined(__x86_64__) || defined(__i386__))
+// SSSE3 & AVX2 kernels are compiled for target attributes and selected at runtime
+#define WEBSOCKET_UTF8_VALIDATOR_AVX2
+#define WEBSOCKET_UTF8_VALIDATOR_SSSE3
+#define WEBSOCKET_UTF8_VALIDATOR_DISPATCH
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#define WEBSOCKET_UTF8_VALIDATOR_SSSE3
+#include <tmmintrin.h>
+#endif
+
+namespace Websocket
+{
+
+/**
+ * @brief Namespace containing vectorized kernels of `Utf8Validator`.
+ *
+ * Kernels implement the lookup algorithm by J. Keiser and D. Lemire,
+ * "Validating UTF-8 In Less Than One Instruction Per Byte" (2021):
+ * every byte is classified by three 16-entry tables indexed by the high and low
+ * nibbles of the previous byte and the high nibble of the current one, the bitwise
+ * AND of the classes is non-zero for any malformed 2-byte window, while the 3rd and 4th
+ * bytes of long sequences are checked by saturating subtraction.
+ */
+namespace Utf8Details
+{
+    // error classes of the (previous byte, current byte) window
+    enum : uint8_t
+    {
+        TooShort = 1U << 0U,     // 11______ 0_______, 11______ 11______
+        TooLong = 1U << 1U,      // 0_______ 10______
+        Overlong3 = 1U << 2U,    // 11100000 100_____
+        TooLarge = 1U << 3U,     // 11110100 1001____, 11110100 101_____, 11110101+ 1001____/101_____
+        Surrogate = 1U << 4U,    // 11101101 101_____
+        Overlong2 = 1U << 5U,    // 1100000_ 10______
+        TooLarge1000 = 1U << 6U, // 11110101+ 1000____
+        Overlong4 = 1U << 6U,    // 11110000 1000____
+        TwoConts = 1U << 7U,     // 10______ 10______
+        Carry = TooShort | TooLong | TwoConts
+    };
+
+    // indexed by the high nibble of the previous byte
+    alignas(16) inline constexpr uint8_t byte1High[16] = {
+        TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+        TwoConts, TwoConts, TwoConts, TwoConts,
+        TooShort | Overlong2,
+        TooShort,
+        TooShort | Overlong3 | Surrogate,
+        TooShort | TooLarge | TooLarge1000 | Overlong4
+    };
+
+    // indexed by the low nibble of the previous byte
+    alignas(16) inline constexpr uint8_t byte1Low[16] = {
+        Carry | Overlong3 | Overlong2 | Overlong4,
+        Carry | Overlong2,
+        Carry,
+        Carry,
+        Carry | TooLarge,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000 | Surrogate,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000
+    };
+
+    // indexed by the high nibble of the current byte
+    alignas(16) inline constexpr uint8_t byte2High[16] = {
+        TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+        TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+        TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+        TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+        TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+        TooShort, TooShort, TooShort, TooShort
+    };
+
+    // maximal values of the last 3 bytes of a block that don't start a sequence
+    // continued in the next block
+    alignas(32) inline constexpr uint8_t incompleteMax[32] = {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xEFU, 0xDFU, 0xBFU
+    };
+
+    /**
+     * @brief Finds the start of a sequence truncated by the end of the validated blocks.
+     *
+     * @param data Pointer to the validated bytes, at least 3.
+     * @param end The number of validated bytes.
+     * @return The position of the lead byte of the truncated sequence, or [end].
+     */
+    inline size_t resumePosition(const uint8_t* data, size_t end) noexcept {
+        if (data[end - 3U] >= 0xF0U) {
+            return end - 3U;
+        }
+        if (data[end - 2U] >= 0xE0U) {
+            return end - 2U;
+        }
+        if (data[end - 1U] >= 0xC0U) {
+            return end - 1U;
+        }
+        return end;
+    }
+
+    // all kernels validate whole blocks of [data] which must start at the sequence boundary,
+    // [valid] is `false` if a malformed sequence was found, otherwise the returned position
+    // is the boundary of the last complete sequence, the scalar validator continues from there
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_SSSE3
+#ifdef WEBSOCKET_UTF8_VALIDATOR_DISPATCH
+    __attribute__((target("ssse3")))
+#endif
+    inline size_t validateSsse3(const uint8_t* data, size_t size, bool& valid) noexcept {
+        const auto table1High = _mm_load_si128(reinterpret_cast<const __m128i*>(byte1High));
+        const auto table1Low = _mm_load_si128(reinterpret_cast<const __m128i*>(byte1Low));
+        const auto table2High = _mm_load_si128(reinterpret_cast<const __m128i*>(byte2High));
+        const auto maxValue = _mm_load_si128(reinterpret_cast<const __m128i*>(incompleteMax + 16));
+        const auto nibble = _mm_set1_epi8(0x0F);
+        const auto zero = _mm_setzero_si128();
+        auto prev = zero, error = zero, prevIncomplete = zero;
+        size_t i = 0U;
+        for (; i + 16U <= size; i += 16U) {
+            const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            if (0 == _mm_movemask_epi8(input)) {
+                error = _mm_or_si128(error, prevIncomplete);
+            }
+            else {
+                const auto prev1 = _mm_alignr_epi8(input, prev, 15);
+                const auto special = _mm_and_si128(
+                    _mm_and_si128(_mm_shuffle_epi8(table1High, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                                  _mm_shuffle_epi8(table1Low, _mm_and_si128(prev1, nibble))),
+                    _mm_shuffle_epi8(table2High, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+                // only 111_____ and 1111____ leave the high bit set
+                const auto third = _mm_subs_epu8(_mm_alignr_epi8(input, prev, 14), _mm_set1_epi8(0x60));
+                const auto fourth = _mm_subs_epu8(_mm_alignr_epi8(input, prev, 13), _mm_set1_epi8(0x70));
+                const auto must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(char(0x80)));
+                error = _mm_or_si128(error, _mm_xor_si128(must23, special));
+                prevIncomplete = _mm_subs_epu8(input, maxValue);
+            }
+            prev = input;
+        }
+        valid = 0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero));
+        return resumePosition(data, i);
+    }
+#endif
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_AVX2
+#ifdef WEBSOCKET_UTF8_VALIDATOR_DISPATCH
+    __attribute__((target("avx2")))
+#endif
+    inline size_t validateAvx2(const uint8_t* data, size_t size, bool& valid) noexcept {
+        const auto table1High = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(byte1High)));
+        const auto table1Low = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(byte1Low)));
+        const auto table2High = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(byte2High)));
+        const auto maxValue = _mm256_load_si256(reinterpret_cast<const __m256i*>(incompleteMax));
+        const auto nibble = _mm256_set1_epi8(0x0F);
+        const auto zero = _mm256_setzero_si256();
+        auto prev = zero, error = zero, prevIncomplete = zero;
+        size_t i = 0U;
+        for (; i + 32U <= size; i += 32U) {
+            const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            if (0 == _mm256_movemask_epi8(input)) {
+                error = _mm256_or_si256(error, prevIncomplete);
+            }
+            else {
+                // high lane of the previous block & low lane of the input, for shifts across lanes
+                const auto carried = _mm256_permute2x128_si256(prev, input, 0x21);
+                const auto prev1 = _mm256_alignr_epi8(input, carried, 15);
+                const auto special = _mm256_and_si256(
+                    _mm256_and_si256(_mm256_shuffle_epi8(table1High, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                                     _mm256_shuffle_epi8(table1Low, _mm256_and_si256(prev1, nibble))),
+                    _mm256_shuffle_epi8(table2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+                const auto third = _mm256_subs_epu8(_mm256_alignr_epi8(input, carried, 14), _mm256_set1_epi8(0x60));
+                const auto fourth = _mm256_subs_epu8(_mm256_alignr_epi8(input, carried, 13), _mm256_set1_epi8(0x70));
+                const auto must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(char(0x80)));
+                error = _mm256_or_si256(error, _mm256_xor_si256(must23, special));
+                prevIncomplete = _mm256_subs_epu8(input, maxValue);
+            }
+            prev = input;
+        }
+        valid = 0 != _mm256_testz_si256(error, error);
+        return resumePosition(data, i);
+    }
+#endif
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_NEON
+    inline size_t validateNeon(const uint8_t* data, size_t size, bool& valid) noexcept {
+        const auto table1High = vld1q_u8(byte1High);
+        const auto table1Low = vld1q_u8(byte1Low);
+        const auto table2High = vld1q_u8(byte2High);
+        const auto maxValue = vld1q_u8(incompleteMax + 16);
+        const auto nibble = vdupq_n_u8(0x0FU);
+        const auto zero = vdupq_n_u8(0U);
+        auto prev = zero, error = zero, prevIncomplete = zero;
+        size_t i = 0U;
+        for (; i + 16U <= size; i += 16U) {
+            const auto input = vld1q_u8(data + i);
+            if (vmaxvq_u8(input) < 0x80U) {
+                error = vorrq_u8(error, prevIncomplete);
+            }
+            else {
+                const auto prev1 = vextq_u8(prev, input, 15);
+                const auto special = vandq_u8(vandq_u8(vqtbl1q_u8(table1High, vshrq_n_u8(prev1, 4)),
+                                                       vqtbl1q_u8(table1Low, vandq_u8(prev1, nibble))),
+                                              vqtbl1q_u8(table2High, vshrq_n_u8(input, 4)));
+                const auto third = vqsubq_u8(vextq_u8(prev, input, 14), vdupq_n_u8(0x60U));
+                const auto fourth = vqsubq_u8(vextq_u8(prev, input, 13), vdupq_n_u8(0x70U));
+                const auto must23 = vandq_u8(vorrq_u8(third, fourth), vdupq_n_u8(0x80U));
+                error = vorrq_u8(error, veorq_u8(must23, special));
+                prevIncomplete = vqsubq_u8(input, maxValue);
+            }
+            prev = input;
+        }
+        valid = 0U == vmaxvq_u8(error);
+        return resumePosition(data, i);
+    }
+#endif
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_DISPATCH
+    inline bool hasSsse3() noexcept {
+        static const bool ssse3 = __builtin_cpu_supports("ssse3");
+        return ssse3;
+    }
+
+    inline bool hasAvx2() noexcept {
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        return avx2;
+    }
+#else
+    inline constexpr bool hasSsse3() noexcept { return true; }
+    inline constexpr bool hasAvx2() noexcept { return true; }
+#endif
+
+    /**
+     * @brief Validates whole blocks by the fastest kernel available on the CPU.
+     *
+     * @return The boundary of the last complete sequence, 0 if no vector kernel is available.
+     */
+    inline size_t validateBlocks(const uint8_t* data, size_t size, bool& valid) noexcept {
+        valid = true;
+#ifdef WEBSOCKET_UTF8_VALIDATOR_AVX2
+        if (size >= 32U && hasAvx2()) {
+            return validateAvx2(data, size, valid);
+        }
+#endif
+#if defined(WEBSOCKET_UTF8_VALIDATOR_SSSE3)
+        if (size >= 16U && hasSsse3()) {
+            return validateSsse3(data, size, valid);
+        }
+#elif defined(WEBSOCKET_UTF8_VALIDATOR_NEON)
+        if (size >= 16U) {
+            return validateNeon(data, size, valid);
+        }
+#endif
+        (void)data;
+        (void)size;
+        return 0U;
+    }
+} // namespace Utf8Details
+
+/**
+ * @brief Incremental UTF-8 validator for text messages.
+ *
+ * The `Utf8Validator` class checks that the payload of a text message is well-formed UTF-8
+ * (no overlong encodings, surrogates or code points above U+10FFFF), as required by RFC 6455.
+ * The payload may be passed by arbitrary chunks, for example frame by frame or read by read,
+ * multi-byte sequences split between chunks are handled correctly.
+ * Runs of at least 16 bytes that start at a sequence boundary are validated by vector kernels
+ * (AVX2 or SSSE3 selected at runtime on GCC and Clang, NEON on AArch64), see `Utf8Details`,
+ * a scalar state machine validates the rest, including sequences split between chunks.
+ * Endpoints close the connection with `CloseCode::InvalidPayload` if validation fails.
+ */
+class Utf8Validator
+{
+public:
+    /**
+     * @brief Validates the next chunk of the message.
+     *
+     * Once a malformed sequence is found the validator stays invalid until `reset`.
+     *
+     * @param data Pointer to the chunk bytes.
+     * @param size The number of bytes in the chunk.
+     * @return `true` if the message is valid so far, otherwise `false`.
+     */
+    bool validate(const uint8_t* data, size_t size) noexcept;
+
+    /**
+     * @brief Validates the next chunk of the message.
+     *
+     * @param text The chunk of the message.
+     * @return `true` if the message is valid so far, otherwise `false`.
+     */
+    bool validate(std::string_view text) noexcept {
+        return validate(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    }
+
+    /**
+     * @brief Checks that the message validated so far doesn't end in the middle of a sequence.
+     *
+     * Should be called after the final chunk of the message.
+     *
+     * @return `true` if the whole message is valid UTF-8, otherwise `false`.
+     */
+    bool complete() const noexcept { return _valid && 0U == _pending; }
+
+    /**
+     * @brief Checks that no malformed sequence was found so far.
+     *
+     * @return `true` if the message is valid so far, otherwise `false`.
+     */
+    bool valid() const noexcept { return _valid; }
+
+    /**
+     * @brief Resets the validator to the initial state, before the next message.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Validates the complete message in one call.
+     *
+     * @param text The message to validate.
+     * @return `true` if the message is valid UTF-8, otherwise `false`.
+     */
+    static bool isValid(std::string_view text) noexcept {
+        Utf8Validator validator;
+        return validator.validate(text) && validator.complete();
+    }
+
+private:
+    static size_t skipAscii(const uint8_t* data, size_t size) noexcept;
+
+private:
+    // number of continuation bytes expected
+    uint8_t _pending = 0U;
+    // allowed range for the next continuation byte
+    uint8_t _lower = 0x80U;
+    uint8_t _upper = 0xBFU;
+    bool _valid = true;
+};
+
+inline bool Utf8Validator::validate(const uint8_t* data, size_t size) noexcept {
+    if (!_valid || !data) {
+        return _valid;
+    }
+    size_t i = 0U;
+    while (i < size) {
+        if (0U == _pending && size - i >= 16U) {
+            bool valid = true;
+            const auto validated = Utf8Details::validateBlocks(data + i, size - i, valid);
+            if (!valid) {
+                _valid = false;
+                break;
+            }
+            i += validated;
+            if (i == size) {
+                break;
+            }
+        }
+        const uint8_t byte = data[i];
+        if (_pending) {
+            if (byte < _lower || byte > _upper) {
+                _valid = false;
+                break;
+            }
+            _lower = 0x80U;
+            _upper = 0xBFU;
+            --_pending;
+            ++i;
+            continue;
+        }
+        if (byte < 0x80U) {
+            i += skipAscii(data + i, size - i);
+            continue;
+        }
+        if (byte >= 0xC2U && byte <= 0xDFU) {
+            _pending = 1U;
+        }
+        else if (byte >= 0xE0U && byte <= 0xEFU) {
+            _pending = 2U;
+            if (0xE0U == byte) {
+                _lower = 0xA0U; // overlong
+            }
+            else if (0xEDU == byte) {
+                _upper = 0x9FU; // surrogates
+            }
+        }
+        else if (byte >= 0xF0U && byte <= 0xF4U) {
+            _pending = 3U;
+            if (0xF0U == byte) {
+                _lower = 0x90U; // overlong
+            }
+            else if (0xF4U == byte) {
+                _upper = 0x8FU; // above U+10FFFF
+            }
+        }
+        else {
+            _valid = false;
+            break;
+        }
+        ++i;
+    }
+    return _valid;
+}
+
+inline void Utf8Validator::reset() noexcept {
+    _pending = 0U;
+    _lower = 0x80U;
+    _upper = 0xBFU;
+    _valid = true;
+}
+
+inline size_t Utf8Validator::skipAscii(const uint8_t* data, size_t size) noexcept {
+    size_t i = 0U;
+#if defined(WEBSOCKET_UTF8_VALIDATOR_SSE2)
+    for (; i + 16U <= size; i += 16U) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (0 != _mm_movemask_epi8(chunk)) {
+            break;
+        }
+    }
+#elif defined(WEBSOCKET_UTF8_VALIDATOR_NEON)
+    for (; i + 16U <= size; i += 16U) {
+        if (vmaxvq_u8(vld1q_u8(data + i)) >= 0x80U) {
+            break;
+        }
+    }
+#endif
+    for (; i + 8U <= size; i += 8U) {
+        uint64_t chunk;
+        std::memcpy(&chunk, data + i, sizeof(chunk));
+        if (0U != (chunk & 0x8080808080808080ULL)) {
+            break;
+        }
+    }
+    while (i < size && data[i] < 0x80U) {
+        ++i;
+    }
+    return i;
+}
+
+} // namespace Websocket
@@ -0,0 +1,81 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkResult.h"
+#include <gtest/gtest.h>
+#include <clocale>
+#include <locale>
+
+namespace Websocket
+{
+
+namespace {
+
+BenchmarkResult makeResult() {
+    BenchmarkResult result;
+    result._scenario = BenchmarkScenario::SmallMessageThroughput;
+    result._operations = 1234567U;
+    result._bytes = 1234567U * 64U;
+    result._elapsed = std::chrono::seconds(1);
+    result._latencyP50 = std::chrono::nanoseconds(1500);
+    result._latencyP99 = std::chrono::nanoseconds(9000);
+    result._latencyP999 = std::chrono::nanoseconds(20000);
+    return result;
+}
+
+} // namespace
+
+TEST(BenchmarkTest, Rates) {
+    const auto result = makeResult();
+    EXPECT_DOUBLE_EQ(1234567., result.operationsPerSecond());
+    EXPECT_DOUBLE_EQ(1234567. * 64., result.bytesPerSecond());
+    EXPECT_EQ(0., BenchmarkResult{}.operationsPerSecond());
+}
+
+TEST(BenchmarkTest, JsonKeepsAllDigits) {
+    const auto json = toJson("impl", {makeResult()});
+    EXPECT_NE(std::string::npos, json.find("\"operations_per_second\":1234567,"));
+    EXPECT_NE(std::string::npos, json.find("\"bytes_per_second\":79012288,"));
+    EXPECT_EQ(std::string::npos, json.find("e+"));
+    EXPECT_NE(std::string::npos, json.find("\"scenario\":\"small_message_throughput\""));
+    EXPECT_NE(std::string::npos, json.find("\"latency_p999_ns\":20000}"));
+}
+
+TEST(BenchmarkTest, JsonFractionalRate) {
+    auto result = makeResult();
+    result._operations = 10U;
+    result._elapsed = std::chrono::nanoseconds(3);
+    const auto json = toJson("impl", {result});
+    EXPECT_NE(std::string::npos, json.find("\"operations_per_second\":3333333333.3333335,"));
+}
+
+TEST(BenchmarkTest, JsonIgnoresGlobalLocale) {
+    struct Grouping : std::numpunct<char>
+    {
+        char do_thousands_sep() const override { return '\''; }
+        char do_decimal_point() const override { return ','; }
+        std::string do_grouping() const override { return "\3"; }
+    };
+    const auto previous = std::locale::global(std::locale(std::locale::classic(), new Grouping));
+    const auto json = toJson("impl", {makeResult()});
+    std::locale::global(previous);
+    EXPECT_NE(std::string::npos, json.find("\"operations\":1234567,"));
+    EXPECT_EQ(std::string::npos, json.find('\''));
+}
+
+TEST(BenchmarkTest, JsonEscapesImplementation) {
+    const auto json = toJson("a\"b\\c\n", {});
+    EXPECT_EQ("{\"implementation\":\"a\\\"b\\\\c\",\"results\":[]}", json);
+}
+
+} // namespace Websocket
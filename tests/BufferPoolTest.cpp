@@ -0,0 +1,129 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketBufferPool.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace Websocket
+{
+
+TEST(BufferPoolTest, SizeClasses) {
+    BufferPool pool;
+    EXPECT_EQ(nullptr, pool.acquire(0U)._data);
+    auto small = pool.acquire(1U);
+    EXPECT_EQ(BufferPool::MinBufferSize, small._capacity);
+    auto medium = pool.acquire(BufferPool::MinBufferSize + 1U);
+    EXPECT_EQ(2U * BufferPool::MinBufferSize, medium._capacity);
+    auto large = pool.acquire(BufferPool::MaxBufferSize + 1U);
+    EXPECT_EQ(BufferPool::MaxBufferSize + 1U, large._capacity);
+    pool.release(small);
+    pool.release(medium);
+    pool.release(large);
+    const auto stats = pool.stats();
+    EXPECT_EQ(3U, stats._misses);
+    // buffers above the largest class bypass the pool
+    EXPECT_EQ(2U, stats._buffersRetained);
+    EXPECT_EQ(3U * BufferPool::MinBufferSize, stats._bytesRetained);
+    EXPECT_EQ(small._data, pool.acquire(10U)._data);
+    EXPECT_EQ(1U, pool.stats()._hits);
+}
+
+TEST(BufferPoolTest, RetentionLimit) {
+    BufferPool pool(BufferPool::MinBufferSize);
+    const auto first = pool.acquire(1U), second = pool.acquire(1U);
+    pool.release(first);
+    pool.release(second);
+    EXPECT_EQ(1U, pool.stats()._buffersRetained);
+    EXPECT_EQ(BufferPool::MinBufferSize, pool.stats()._bytesRetained);
+}
+
+// a reader thread acquires buffers which are released by a worker thread,
+// the reader must reuse them instead of allocating a new buffer per frame
+TEST(BufferPoolTest, ReusesBuffersReleasedByOtherThreads) {
+    constexpr size_t frames = 64U, rounds = 50U;
+    BufferPool pool;
+    for (size_t round = 0U; round < rounds; ++round) {
+        std::vector<BufferPool::Buffer> buffers;
+        std::thread reader([&]() {
+            for (size_t i = 0U; i < frames; ++i) {
+                buffers.push_back(pool.acquire(512U));
+            }
+        });
+        reader.join();
+        std::thread worker([&]() {
+            for (const auto& buffer : buffers) {
+                pool.release(buffer);
+            }
+        });
+        worker.join();
+    }
+    const auto stats = pool.stats();
+    EXPECT_EQ(frames, stats._misses);
+    EXPECT_EQ(frames * (rounds - 1U), stats._hits);
+    EXPECT_EQ(frames, stats._buffersRetained);
+}
+
+// buffers of other size classes retained by other stripes don't satisfy the request
+TEST(BufferPoolTest, OtherSizeClassesAreNotStolen) {
+    BufferPool pool;
+    std::thread worker([&pool]() { pool.release(pool.acquire(100U)); });
+    worker.join();
+    const auto large = pool.acquire(4096U);
+    EXPECT_EQ(1U, pool.stats()._buffersRetained);
+    EXPECT_EQ(2U, pool.stats()._misses);
+    const auto small = pool.acquire(100U);
+    EXPECT_EQ(128U, small._capacity);
+    EXPECT_EQ(1U, pool.stats()._hits);
+    EXPECT_EQ(0U, pool.stats()._buffersRetained);
+    // the emptied stripe is skipped, a new buffer is allocated
+    const auto next = pool.acquire(100U);
+    EXPECT_EQ(3U, pool.stats()._misses);
+    pool.release(large);
+    pool.release(small);
+    pool.release(next);
+}
+
+TEST(BufferPoolTest, ConcurrentAcquireRelease) {
+    constexpr size_t threads = 4U, iterations = 20000U;
+    BufferPool pool;
+    std::vector<std::thread> workers;
+    for (size_t t = 0U; t < threads; ++t) {
+        workers.emplace_back([&pool, t]() {
+            std::vector<BufferPool::Buffer> held;
+            for (size_t i = 0U; i < iterations; ++i) {
+                held.push_back(pool.acquire(64U << ((i + t) % 4U)));
+                held.back()._data[0] = static_cast<uint8_t>(i);
+                if (held.size() == 8U) {
+                    for (const auto& buffer : held) {
+                        pool.release(buffer);
+                    }
+                    held.clear();
+                }
+            }
+            for (const auto& buffer : held) {
+                pool.release(buffer);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto stats = pool.stats();
+    EXPECT_EQ(threads * iterations, stats._hits + stats._misses);
+    EXPECT_EQ(stats._misses, stats._buffersRetained);
+    EXPECT_GT(stats.hitRate(), 0.9);
+}
+
+} // namespace Websocket
@@ -0,0 +1,47 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketCompression.h"
+#include <gtest/gtest.h>
+
+namespace Websocket
+{
+
+TEST(CompressionTest, DefaultOffer) {
+    EXPECT_EQ("permessage-deflate; client_max_window_bits", extensionOffer(Compression()));
+}
+
+TEST(CompressionTest, OfferWithParameters) {
+    Compression compression;
+    compression._serverNoContextTakeover = true;
+    compression._clientNoContextTakeover = true;
+    compression._serverMaxWindowBits = 10U;
+    compression._clientMaxWindowBits = 12U;
+    EXPECT_EQ("permessage-deflate; server_no_context_takeover; client_no_context_takeover; "
+              "server_max_window_bits=10; client_max_window_bits=12", extensionOffer(compression));
+}
+
+TEST(CompressionTest, WindowBitsAreClamped) {
+    EXPECT_EQ(8U, clampWindowBits(0U));
+    EXPECT_EQ(8U, clampWindowBits(7U));
+    EXPECT_EQ(8U, clampWindowBits(8U));
+    EXPECT_EQ(15U, clampWindowBits(15U));
+    EXPECT_EQ(15U, clampWindowBits(16U));
+    Compression compression;
+    compression._serverMaxWindowBits = 0U;
+    compression._clientMaxWindowBits = 255U;
+    EXPECT_EQ("permessage-deflate; server_max_window_bits=8; client_max_window_bits",
+              extensionOffer(compression));
+}
+
+} // namespace Websocket
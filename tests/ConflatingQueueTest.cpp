@@ -0,0 +1,103 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketConflatingQueue.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace Websocket
+{
+
+namespace {
+
+SendOptions options(SendPriority priority, std::optional<uint64_t> key = std::nullopt) {
+    SendOptions options;
+    options._priority = priority;
+    options._conflationKey = key;
+    return options;
+}
+
+std::vector<std::string> drain(ConflatingQueue<std::string>& queue) {
+    std::vector<std::string> messages;
+    std::string message;
+    while (queue.pop(message)) {
+        messages.push_back(message);
+    }
+    return messages;
+}
+
+} // namespace
+
+TEST(ConflatingQueueTest, FifoIgnoresOptions) {
+    ConflatingQueue<std::string> queue(SendQueue::Fifo);
+    EXPECT_FALSE(queue.push("a", options(SendPriority::Low, 1U)));
+    EXPECT_FALSE(queue.push("b", options(SendPriority::High, 1U)));
+    EXPECT_FALSE(queue.push("c"));
+    EXPECT_EQ(3U, queue.size());
+    EXPECT_EQ((std::vector<std::string>{"a", "b", "c"}), drain(queue));
+    EXPECT_EQ(0U, queue.conflated());
+}
+
+TEST(ConflatingQueueTest, PopsByPriorityKeepingOrder) {
+    ConflatingQueue<std::string> queue;
+    queue.push("low", options(SendPriority::Low));
+    queue.push("normal1");
+    queue.push("high", options(SendPriority::High));
+    queue.push("normal2");
+    EXPECT_EQ((std::vector<std::string>{"high", "normal1", "normal2", "low"}), drain(queue));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ConflatingQueueTest, NewerMessageReplacesQueuedInPlace) {
+    ConflatingQueue<std::string> queue;
+    queue.push("a1", options(SendPriority::Normal, 1U));
+    queue.push("b1", options(SendPriority::Normal, 2U));
+    EXPECT_TRUE(queue.push("a2", options(SendPriority::Normal, 1U)));
+    EXPECT_TRUE(queue.push("a3", options(SendPriority::Normal, 1U)));
+    EXPECT_EQ(2U, queue.size());
+    EXPECT_EQ(2U, queue.conflated());
+    EXPECT_EQ((std::vector<std::string>{"a3", "b1"}), drain(queue));
+    // the key is free again after the message is written
+    EXPECT_FALSE(queue.push("a4", options(SendPriority::Normal, 1U)));
+    EXPECT_EQ((std::vector<std::string>{"a4"}), drain(queue));
+}
+
+TEST(ConflatingQueueTest, ReplacementWithAnotherPriorityMovesMessage) {
+    ConflatingQueue<std::string> queue;
+    queue.push("a1", options(SendPriority::Low, 1U));
+    queue.push("b");
+    EXPECT_TRUE(queue.push("a2", options(SendPriority::High, 1U)));
+    EXPECT_EQ(2U, queue.size());
+    EXPECT_TRUE(queue.push("a3", options(SendPriority::High, 1U)));
+    EXPECT_EQ((std::vector<std::string>{"a3", "b"}), drain(queue));
+    EXPECT_EQ(2U, queue.conflated());
+}
+
+TEST(ConflatingQueueTest, InterleavedPushAndPop) {
+    ConflatingQueue<std::string> queue;
+    std::string message;
+    for (int round = 0; round < 100; ++round) {
+        for (uint64_t key = 0U; key < 4U; ++key) {
+            queue.push(std::to_string(round) + ':' + std::to_string(key), options(SendPriority::Normal, key));
+        }
+        ASSERT_TRUE(queue.pop(message));
+        EXPECT_EQ(std::to_string(round) + ':' + std::to_string(round % 4), message);
+        EXPECT_EQ(3U, queue.size());
+    }
+    // a written key is queued again at the tail, so keys are written round-robin,
+    // the last round wrote key 3, the others keep their latest values
+    EXPECT_EQ((std::vector<std::string>{"99:0", "99:1", "99:2"}), drain(queue));
+}
+
+} // namespace Websocket
@@ -0,0 +1,141 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketFrameCodec.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace Websocket
+{
+
+namespace {
+
+using Kernel = void (*)(uint8_t*, size_t, const FrameCodec::MaskKey&, size_t);
+
+constexpr size_t maxSize = 700U;
+constexpr size_t maxMisalignment = 32U;
+const FrameCodec::MaskKey key = {0x37U, 0xFAU, 0x21U, 0x3DU};
+
+void maskReference(uint8_t* data, size_t size, const FrameCodec::MaskKey& key, size_t offset) {
+    for (size_t i = 0U; i < size; ++i) {
+        data[i] ^= key[(offset + i) % 4U];
+    }
+}
+
+std::vector<uint8_t> makePayload(size_t size) {
+    std::vector<uint8_t> payload(size);
+    for (size_t i = 0U; i < size; ++i) {
+        payload[i] = static_cast<uint8_t>(i * 131U + 7U);
+    }
+    return payload;
+}
+
+// compares the kernel with the bytewise reference for every size in [0, maxSize],
+// every buffer misalignment in [0, maxMisalignment) and every key phase,
+// bytes around the transformed range must stay untouched
+void expectEquivalent(Kernel kernel, size_t minSize = 0U) {
+    const auto source = makePayload(maxSize + maxMisalignment + 1U);
+    for (size_t size = minSize; size <= maxSize; ++size) {
+        for (size_t misalignment = 0U; misalignment < maxMisalignment; ++misalignment) {
+            for (size_t offset = 0U; offset < 4U; ++offset) {
+                auto expected = source, actual = source;
+                maskReference(expected.data() + misalignment, size, key, offset);
+                kernel(actual.data() + misalignment, size, key, offset);
+                ASSERT_EQ(expected, actual) << "size " << size << ", misalignment " << misalignment
+                                            << ", offset " << offset;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(FrameCodecTest, MaskMatchesReference) {
+    expectEquivalent(&FrameCodec::mask);
+}
+
+TEST(FrameCodecTest, ScalarKernelMatchesReference) {
+    expectEquivalent(&FrameCodec::Details::maskScalar);
+}
+
+#ifdef WEBSOCKET_FRAME_CODEC_SSE2
+TEST(FrameCodecTest, Sse2KernelMatchesReference) {
+    expectEquivalent(&FrameCodec::Details::maskSse2);
+}
+#endif
+
+#ifdef WEBSOCKET_FRAME_CODEC_AVX2
+TEST(FrameCodecTest, Avx2KernelMatchesReference) {
+    if (!FrameCodec::Details::hasAvx2()) {
+        GTEST_SKIP() << "AVX2 is not supported by CPU";
+    }
+    expectEquivalent(&FrameCodec::Details::maskAvx2);
+}
+#endif
+
+#ifdef WEBSOCKET_FRAME_CODEC_NEON
+TEST(FrameCodecTest, NeonKernelMatchesReference) {
+    expectEquivalent(&FrameCodec::Details::maskNeon);
+}
+#endif
+
+TEST(FrameCodecTest, ChunkedMaskMatchesWholeMask) {
+    const auto source = makePayload(maxSize);
+    auto whole = source;
+    FrameCodec::mask(whole.data(), whole.size(), key);
+    for (size_t chunk = 1U; chunk <= 67U; ++chunk) {
+        auto chunked = source;
+        for (size_t pos = 0U; pos < chunked.size(); pos += chunk) {
+            const auto size = std::min(chunk, chunked.size() - pos);
+            FrameCodec::mask(chunked.data() + pos, size, key, pos);
+        }
+        ASSERT_EQ(whole, chunked) << "chunk " << chunk;
+    }
+}
+
+TEST(FrameCodecTest, UnmaskRestoresPayload) {
+    const auto source = makePayload(maxSize);
+    auto payload = source;
+    FrameCodec::mask(payload.data(), payload.size(), key, 1U);
+    EXPECT_NE(source, payload);
+    FrameCodec::unmask(payload.data(), payload.size(), key, 1U);
+    EXPECT_EQ(source, payload);
+}
+
+TEST(FrameCodecTest, HeaderSizes) {
+    EXPECT_EQ(2U, FrameCodec::headerSize(0U, false));
+    EXPECT_EQ(6U, FrameCodec::headerSize(125U, true));
+    EXPECT_EQ(4U, FrameCodec::headerSize(126U, false));
+    EXPECT_EQ(8U, FrameCodec::headerSize(0xFFFFU, true));
+    EXPECT_EQ(10U, FrameCodec::headerSize(0x10000U, false));
+    EXPECT_EQ(FrameCodec::MaxHeaderSize, FrameCodec::headerSize(UINT64_MAX, true));
+}
+
+TEST(FrameCodecTest, WriteHeader) {
+    uint8_t out[FrameCodec::MaxHeaderSize];
+    ASSERT_EQ(2U, FrameCodec::writeHeader(out, Opcode::Text, true, 5U));
+    EXPECT_EQ(0x81U, out[0]);
+    EXPECT_EQ(0x05U, out[1]);
+    ASSERT_EQ(8U, FrameCodec::writeHeader(out, Opcode::Binary, false, 300U, &key, true));
+    EXPECT_EQ(0x42U, out[0]);
+    EXPECT_EQ(0x80U | 126U, out[1]);
+    EXPECT_EQ(0x01U, out[2]);
+    EXPECT_EQ(0x2CU, out[3]);
+    EXPECT_EQ(0, std::memcmp(out + 4, key.data(), key.size()));
+    ASSERT_EQ(10U, FrameCodec::writeHeader(out, Opcode::Binary, true, 0x0102030405ULL));
+    EXPECT_EQ(127U, out[1]);
+    const uint8_t length[8] = {0U, 0U, 0U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U};
+    EXPECT_EQ(0, std::memcmp(out + 2, length, sizeof(length)));
+}
+
+} // namespace Websocket
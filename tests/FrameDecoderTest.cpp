@@ -0,0 +1,188 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "FrameRecorder.h"
+#include <gtest/gtest.h>
+
+namespace Websocket
+{
+
+namespace {
+
+const FrameCodec::MaskKey key = {0x11U, 0x22U, 0x33U, 0x44U};
+
+using Bytes = std::vector<uint8_t>;
+
+std::string closePayload(uint16_t code, std::string_view reason = {}) {
+    std::string payload;
+    payload += static_cast<char>(code >> 8);
+    payload += static_cast<char>(code & 0xFFU);
+    payload += reason;
+    return payload;
+}
+
+// decodes by a single call, for client side by default
+FrameRecorder decode(Bytes bytes, bool server = false, uint64_t maxMessageSize = 0U,
+                     bool perMessageDeflate = false) {
+    FrameRecorder recorder;
+    FrameDecoder decoder(recorder, server, maxMessageSize, perMessageDeflate);
+    const bool ok = decoder.decode(bytes.data(), bytes.size());
+    EXPECT_EQ(ok, 0U == recorder._errorCode);
+    EXPECT_EQ(!ok, decoder.failed());
+    return recorder;
+}
+
+uint16_t errorOf(Bytes bytes, bool server = false, uint64_t maxMessageSize = 0U) {
+    const auto recorder = decode(std::move(bytes), server, maxMessageSize);
+    // decoding stops at the first violation
+    EXPECT_FALSE(recorder._events.empty());
+    if (!recorder._events.empty()) {
+        EXPECT_EQ(0U, recorder._events.back().rfind("error:", 0U));
+    }
+    return recorder._errorCode;
+}
+
+Bytes frame(Opcode opcode, std::string_view payload, bool fin = true, const FrameCodec::MaskKey* mask = nullptr,
+            bool rsv1 = false) {
+    Bytes bytes;
+    appendTestFrame(bytes, opcode, payload, fin, mask, rsv1);
+    return bytes;
+}
+
+Bytes operator+(Bytes lhs, const Bytes& rhs) {
+    lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+    return lhs;
+}
+
+} // namespace
+
+TEST(FrameDecoderTest, SingleFrameMessages) {
+    const auto recorder = decode(frame(Opcode::Text, "hello") + frame(Opcode::Binary, "") +
+                                 frame(Opcode::Binary, std::string(300U, 'x')));
+    const std::vector<std::string> expected = {"text+-:hello", "binary+-:", "binary+-:" + std::string(300U, 'x')};
+    EXPECT_EQ(expected, recorder._events);
+}
+
+TEST(FrameDecoderTest, FragmentedMessageWithInterleavedControl) {
+    const auto recorder = decode(frame(Opcode::Text, "Hel", false) + frame(Opcode::Ping, "p") +
+                                 frame(Opcode::Continuation, "lo", false) + frame(Opcode::Pong, "") +
+                                 frame(Opcode::Continuation, "", true) + frame(Opcode::Close, closePayload(1000U, "bye")));
+    const std::vector<std::string> expected = {"text+:Hel", "ping:p", "text:lo", "pong:", "text-:",
+                                               "close:1000:bye"};
+    EXPECT_EQ(expected, recorder._events);
+}
+
+TEST(FrameDecoderTest, ServerUnmasksPayload) {
+    const auto payload = std::string(70000U, 'm');
+    const auto recorder = decode(frame(Opcode::Binary, payload, true, &key), true);
+    ASSERT_EQ(1U, recorder._messages.size());
+    EXPECT_EQ(payload, recorder._messages.front());
+}
+
+TEST(FrameDecoderTest, ByteByByteMatchesWholeInput) {
+    auto bytes = frame(Opcode::Text, "Привет", false, &key) + frame(Opcode::Ping, "ping", true, &key) +
+                 frame(Opcode::Continuation, ", мир", true, &key) +
+                 frame(Opcode::Binary, std::string(200U, 'b'), true, &key) + frame(Opcode::Close, "", true, &key);
+    const auto whole = decode(bytes, true);
+    FrameRecorder recorder;
+    FrameDecoder decoder(recorder, true);
+    for (auto& byte : bytes) {
+        ASSERT_TRUE(decoder.decode(&byte, 1U));
+    }
+    EXPECT_TRUE(decoder.closed());
+    EXPECT_EQ(whole._messages, recorder._messages);
+    const std::vector<std::string> messages = {"Привет, мир", std::string(200U, 'b')};
+    EXPECT_EQ(messages, recorder._messages);
+}
+
+TEST(FrameDecoderTest, BytesAfterCloseAreIgnored) {
+    const auto recorder = decode(frame(Opcode::Close, closePayload(1001U)) + frame(Opcode::Text, "late"));
+    const std::vector<std::string> expected = {"close:1001:"};
+    EXPECT_EQ(expected, recorder._events);
+}
+
+TEST(FrameDecoderTest, ResetAfterFailure) {
+    FrameRecorder recorder;
+    FrameDecoder decoder(recorder, false);
+    auto bad = frame(Opcode::Continuation, "x");
+    EXPECT_FALSE(decoder.decode(bad.data(), bad.size()));
+    auto good = frame(Opcode::Text, "x");
+    EXPECT_FALSE(decoder.decode(good.data(), good.size()));
+    decoder.reset();
+    EXPECT_TRUE(decoder.decode(good.data(), good.size()));
+    EXPECT_EQ("text+-:x", recorder._events.back());
+}
+
+TEST(FrameDecoderTest, ProtocolErrors) {
+    // reserved bits
+    auto reserved = frame(Opcode::Text, "x");
+    reserved[0] |= 0x20U;
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(reserved));
+    // masking direction
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Text, "x"), true));
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Text, "x", true, &key)));
+    // fragmentation
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Continuation, "x")));
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Text, "a", false) + frame(Opcode::Binary, "b")));
+    // control frames
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Ping, "x", false)));
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Pong, std::string(126U, 'x'))));
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Ping, "x", true, nullptr, true)));
+    // unknown opcodes & compression without negotiation
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(static_cast<Opcode>(0x3U), "x")));
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(static_cast<Opcode>(0xBU), "")));
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Text, "x", true, nullptr, true)));
+    // 64-bit length with the most significant bit
+    const Bytes length = {0x82U, 127U, 0x80U, 0U, 0U, 0U, 0U, 0U, 0U, 1U};
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(length));
+    // close frames
+    EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Close, "x")));
+    for (uint16_t code : {0U, 999U, 1004U, 1005U, 1006U, 1016U, 2999U, 5000U}) {
+        EXPECT_EQ(CloseCode::ProtocolError, errorOf(frame(Opcode::Close, closePayload(code)))) << code;
+    }
+}
+
+TEST(FrameDecoderTest, CompressedMessageWithNegotiatedDeflate) {
+    const auto recorder = decode(frame(Opcode::Text, "\xFF\x00", true, nullptr, true), false, 0U, true);
+    ASSERT_EQ(1U, recorder._events.size());
+    EXPECT_EQ(0U, recorder._events.front().rfind("textz+-:", 0U));
+}
+
+TEST(FrameDecoderTest, InvalidPayload) {
+    EXPECT_EQ(CloseCode::InvalidPayload, errorOf(frame(Opcode::Text, "\xC0\xAF")));
+    EXPECT_EQ(CloseCode::InvalidPayload, errorOf(frame(Opcode::Text, "ok\xED\xA0\x80")));
+    // sequence split between fragments is valid, truncated at the final fragment is not
+    EXPECT_TRUE(decode(frame(Opcode::Text, "\xE2\x82", false) + frame(Opcode::Continuation, "\xAC"))._errorCode == 0U);
+    EXPECT_EQ(CloseCode::InvalidPayload,
+              errorOf(frame(Opcode::Text, "abc", false) + frame(Opcode::Continuation, "\xE2\x82")));
+    EXPECT_EQ(CloseCode::InvalidPayload, errorOf(frame(Opcode::Close, closePayload(1000U, "\xFF"))));
+    // binary payloads are not validated
+    EXPECT_EQ(0U, decode(frame(Opcode::Binary, "\xFF"))._errorCode);
+}
+
+TEST(FrameDecoderTest, MessageTooBig) {
+    EXPECT_EQ(0U, decode(frame(Opcode::Binary, std::string(16U, 'x')), false, 16U)._errorCode);
+    EXPECT_EQ(CloseCode::MessageTooBig, errorOf(frame(Opcode::Binary, std::string(17U, 'x')), false, 16U));
+    // the limit applies to the whole message, not to frames
+    EXPECT_EQ(CloseCode::MessageTooBig,
+              errorOf(frame(Opcode::Text, std::string(10U, 'x'), false) +
+                      frame(Opcode::Continuation, std::string(10U, 'x')), false, 16U));
+    // control frames don't count
+    EXPECT_EQ(0U, decode(frame(Opcode::Text, std::string(10U, 'x'), false) + frame(Opcode::Ping, std::string(100U, 'p')) +
+                         frame(Opcode::Continuation, std::string(6U, 'x')), false, 16U)._errorCode);
+    // rejected by the header, before the payload arrives
+    const Bytes huge = {0x82U, 127U, 0U, 0U, 0U, 1U, 0U, 0U, 0U, 0U};
+    EXPECT_EQ(CloseCode::MessageTooBig, errorOf(huge, false, 1U << 20U));
+}
+
+} // namespace Websocket
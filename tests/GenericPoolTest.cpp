@@ -0,0 +1,184 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "InProcessFactory.h"
+#include "WebsocketGenericPool.h"
+#include <gtest/gtest.h>
+
+namespace Websocket
+{
+
+namespace {
+
+class Server : public AcceptorListener
+{
+public:
+    std::vector<std::unique_ptr<EndPoint>> _endPoints;
+    // impl. of AcceptorListener
+    void onAccepted(std::unique_ptr<EndPoint> endPoint, uint64_t) final {
+        _endPoints.push_back(std::move(endPoint));
+    }
+    void closeAll() {
+        for (const auto& endPoint : _endPoints) {
+            endPoint->close();
+        }
+    }
+};
+
+// counts `close` calls of an endpoint of the factory
+class ClosingEndPoint : public EndPoint
+{
+public:
+    ClosingEndPoint(std::unique_ptr<EndPoint> impl, size_t& closes)
+        : _impl(std::move(impl))
+        , _closes(closes)
+    {
+    }
+    // impl. of EndPoint
+    void setListener(const std::shared_ptr<Listener>& listener) final { _impl->setListener(listener); }
+    bool open(Options options, uint64_t connectionId) final { return _impl->open(std::move(options), connectionId); }
+    void close() final {
+        ++_closes;
+        _impl->close();
+    }
+    std::string host() const final { return _impl->host(); }
+    State state() const final { return _impl->state(); }
+    bool sendBinary(const Bricks::Blob& binary) final { return _impl->sendBinary(binary); }
+    bool sendText(std::string_view text) final { return _impl->sendText(text); }
+    bool ping(const Bricks::Blob& payload) final { return _impl->ping(payload); }
+    bool ping() final { return _impl->ping(); }
+
+private:
+    const std::unique_ptr<EndPoint> _impl;
+    size_t& _closes;
+};
+
+Options target(std::string url, std::string token = {}) {
+    Options options;
+    options._host = std::move(url);
+    if (!token.empty()) {
+        options._extraHeaders["Authorization"] = "Bearer " + token;
+    }
+    return options;
+}
+
+} // namespace
+
+class GenericPoolTest : public ::testing::Test
+{
+protected:
+    void SetUp() override {
+        _acceptor = _factory.createAcceptor();
+        AcceptorOptions options;
+        options._address = "inproc://server";
+        ASSERT_TRUE(_acceptor->start(std::move(options), _server));
+    }
+    std::unique_ptr<Pool> createPool(std::chrono::milliseconds refillInterval = std::chrono::hours(1)) const {
+        PoolOptions options;
+        options._endpointsPerKey = 2U;
+        options._refillInterval = refillInterval;
+        return _factory.createPool(options);
+    }
+    InProcessFactory _factory;
+    std::shared_ptr<Server> _server = std::make_shared<Server>();
+    std::unique_ptr<Acceptor> _acceptor;
+};
+
+TEST_F(GenericPoolTest, DefaultFactoryPoolWarmsUpPerKey) {
+    auto pool = createPool();
+    ASSERT_TRUE(pool);
+    const auto alice = pool->warmUp(target("inproc://server/a", "alice"));
+    const auto bob = pool->warmUp(target("inproc://server/a", "bob"));
+    ASSERT_NE(0U, alice);
+    ASSERT_NE(0U, bob);
+    EXPECT_NE(alice, bob);
+    // equal hosts with different credentials are pooled separately
+    EXPECT_EQ(4U, _server->_endPoints.size());
+    EXPECT_EQ(nullptr, pool->acquire(alice + bob));
+}
+
+TEST_F(GenericPoolTest, AcquireAndRelease) {
+    auto pool = createPool();
+    const auto a = pool->warmUp(target("inproc://server/a"));
+    const auto b = pool->warmUp(target("inproc://server/b"));
+    auto endPoint = pool->acquire(b);
+    ASSERT_TRUE(endPoint);
+    EXPECT_EQ(State::Connected, endPoint->state());
+    EXPECT_EQ("inproc://server/b", endPoint->host());
+    // refilled after acquisition
+    EXPECT_EQ(5U, _server->_endPoints.size());
+    pool->release(std::move(endPoint));
+    // the pool is full, the released endpoint is closed
+    EXPECT_EQ(State::Disconnected, _server->_endPoints[2]->state());
+    EXPECT_EQ("inproc://server/a", pool->acquire(a)->host());
+    const auto stats = pool->stats();
+    EXPECT_EQ(2U, stats._hits);
+    EXPECT_EQ(0U, stats._misses);
+    EXPECT_EQ(1., stats.hitRate());
+}
+
+TEST_F(GenericPoolTest, EvictsUnhealthyEndpoints) {
+    auto pool = createPool(std::chrono::milliseconds(0));
+    const auto key = pool->warmUp(target("inproc://server/"));
+    auto endPoint = pool->acquire(key);
+    ASSERT_TRUE(endPoint);
+    _server->closeAll();
+    EXPECT_EQ(State::Disconnected, endPoint->state());
+    pool->release(std::move(endPoint));
+    // both idle endpoints are disconnected and replaced by the health check of `release`
+    auto stats = pool->stats();
+    EXPECT_EQ(3U, stats._evictions);
+    EXPECT_EQ(5U, _server->_endPoints.size());
+    endPoint = pool->acquire(key);
+    ASSERT_TRUE(endPoint);
+    EXPECT_EQ(State::Connected, endPoint->state());
+    stats = pool->stats();
+    EXPECT_EQ(2U, stats._hits);
+    EXPECT_EQ(0U, stats._misses);
+}
+
+TEST_F(GenericPoolTest, ClosesEvictedEndpoints) {
+    size_t closes = 0U;
+    PoolOptions options;
+    options._endpointsPerKey = 2U;
+    options._refillInterval = std::chrono::milliseconds(0);
+    GenericPool pool([this, &closes]() { return std::make_unique<ClosingEndPoint>(_factory.create(), closes); },
+                     options);
+    const auto key = pool.warmUp(target("inproc://server/"));
+    _server->closeAll();
+    EXPECT_EQ(0U, closes);
+    // both idle endpoints are evicted by the health check of `acquire`
+    auto endPoint = pool.acquire(key);
+    ASSERT_TRUE(endPoint);
+    EXPECT_EQ(2U, closes);
+    EXPECT_EQ(2U, pool.stats()._evictions);
+    pool.release(std::move(endPoint));
+}
+
+TEST_F(GenericPoolTest, OpensOnMiss) {
+    auto pool = createPool(std::chrono::milliseconds(0));
+    const auto key = pool->warmUp(target("inproc://server/"));
+    _server->closeAll();
+    _acceptor->stop();
+    // idle endpoints are evicted and can't be replaced
+    EXPECT_EQ(nullptr, pool->acquire(key));
+    AcceptorOptions options;
+    options._address = "inproc://server";
+    ASSERT_TRUE(_acceptor->start(std::move(options), _server));
+    auto endPoint = pool->acquire(key);
+    ASSERT_TRUE(endPoint);
+    EXPECT_EQ(State::Connected, endPoint->state());
+    EXPECT_EQ(2U, pool->stats()._misses);
+}
+
+} // namespace Websocket
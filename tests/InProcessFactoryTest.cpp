@@ -0,0 +1,192 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "InProcessFactory.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace Websocket
+{
+
+namespace {
+
+class RecordingListener : public Listener
+{
+public:
+    std::vector<State> _states;
+    std::vector<std::string> _texts;
+    std::vector<std::shared_ptr<const Bricks::Blob>> _binaries;
+    size_t _pongs = 0U;
+    size_t _errors = 0U;
+    std::vector<Error> _closeErrors;
+    // impl. of Listener
+    void onStateChanged(uint64_t, uint64_t, State state) final { _states.push_back(state); }
+    void onError(uint64_t, uint64_t, const Error& error) final {
+        ++_errors;
+        if (inProcessCloseCategory() == error._code.category()) {
+            _closeErrors.push_back(error);
+        }
+    }
+    void onTextMessage(uint64_t, uint64_t, const std::string_view& message) final {
+        _texts.emplace_back(message);
+    }
+    void onSharedBinaryMessage(uint64_t, uint64_t, std::shared_ptr<const Bricks::Blob> message) final {
+        _binaries.push_back(std::move(message));
+    }
+    void onPong(uint64_t, uint64_t, const Bricks::Blob&) final { ++_pongs; }
+};
+
+class Server : public AcceptorListener
+{
+public:
+    std::string _resource;
+    std::vector<std::unique_ptr<EndPoint>> _endPoints;
+    std::shared_ptr<RecordingListener> _listener = std::make_shared<RecordingListener>();
+    bool _reject = false;
+    // impl. of AcceptorListener
+    bool onUpgradeRequest(std::string_view resource, const std::unordered_map<std::string, std::string>&) final {
+        _resource = std::string(resource);
+        return !_reject;
+    }
+    void onAccepted(std::unique_ptr<EndPoint> endPoint, uint64_t) final {
+        endPoint->setListener(_listener);
+        _endPoints.push_back(std::move(endPoint));
+    }
+};
+
+Options inProcess(std::string url) {
+    Options options;
+    options._host = std::move(url);
+    return options;
+}
+
+} // namespace
+
+class InProcessFactoryTest : public ::testing::Test
+{
+protected:
+    void SetUp() override {
+        _acceptor = _factory.createAcceptor();
+        AcceptorOptions options;
+        options._address = "inproc://echo";
+        ASSERT_TRUE(_acceptor->start(std::move(options), _server));
+        _endPoint = _factory.create();
+        _endPoint->setListener(_client);
+    }
+    InProcessFactory _factory;
+    std::shared_ptr<Server> _server = std::make_shared<Server>();
+    std::shared_ptr<RecordingListener> _client = std::make_shared<RecordingListener>();
+    std::unique_ptr<Acceptor> _acceptor;
+    std::unique_ptr<EndPoint> _endPoint;
+};
+
+TEST_F(InProcessFactoryTest, ConnectsToAcceptor) {
+    EXPECT_FALSE(_factory.supportsScheme(Scheme::Ws));
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/stream"), 7U));
+    EXPECT_EQ(State::Connected, _endPoint->state());
+    EXPECT_EQ((std::vector<State>{State::Connecting, State::Connected}), _client->_states);
+    EXPECT_EQ("/stream", _server->_resource);
+    ASSERT_EQ(1U, _server->_endPoints.size());
+    EXPECT_EQ(State::Connected, _server->_endPoints.front()->state());
+    EXPECT_FALSE(_server->_endPoints.front()->open(inProcess("inproc://echo")));
+}
+
+TEST_F(InProcessFactoryTest, FailsWithoutAcceptor) {
+    EXPECT_FALSE(_endPoint->open(inProcess("inproc://missing/")));
+    EXPECT_EQ(1U, _client->_errors);
+    EXPECT_EQ(State::Disconnected, _endPoint->state());
+    EXPECT_FALSE(_endPoint->open(inProcess("ws://127.0.0.1/")));
+    _server->_reject = true;
+    EXPECT_FALSE(_endPoint->open(inProcess("inproc://echo/")));
+    EXPECT_TRUE(_server->_endPoints.empty());
+    EXPECT_FALSE(_endPoint->sendText("lost"));
+}
+
+TEST_F(InProcessFactoryTest, SharedBinaryIsNotCopied) {
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/")));
+    const auto blob = std::make_shared<const BytesBlob>(std::string_view("payload"));
+    ASSERT_TRUE(_endPoint->sendSharedBinary(blob));
+    ASSERT_TRUE(_endPoint->sendBinary(*blob));
+    ASSERT_TRUE(_endPoint->sendText("text"));
+    const auto& received = _server->_listener->_binaries;
+    ASSERT_EQ(2U, received.size());
+    EXPECT_EQ(blob, received[0]);
+    EXPECT_NE(blob, received[1]);
+    EXPECT_EQ(blob->bytes(), dynamic_cast<const BytesBlob&>(*received[1]).bytes());
+    EXPECT_EQ(std::vector<std::string>{"text"}, _server->_listener->_texts);
+    ASSERT_TRUE(_server->_endPoints.front()->sendText("reply"));
+    EXPECT_EQ(std::vector<std::string>{"reply"}, _client->_texts);
+}
+
+TEST_F(InProcessFactoryTest, PingAndClose) {
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/")));
+    EXPECT_TRUE(_endPoint->ping());
+    EXPECT_EQ(1U, _client->_pongs);
+    EXPECT_EQ(0U, _server->_listener->_pongs);
+    _server->_endPoints.front()->close();
+    EXPECT_EQ(State::Disconnected, _endPoint->state());
+    EXPECT_EQ(State::Disconnected, _client->_states.back());
+    EXPECT_FALSE(_endPoint->ping());
+    EXPECT_FALSE(_endPoint->sendText("lost"));
+    // reconnect with the same endpoint
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/")));
+    EXPECT_EQ(2U, _server->_endPoints.size());
+    _endPoint.reset();
+    EXPECT_EQ(State::Disconnected, _server->_endPoints.back()->state());
+}
+
+TEST_F(InProcessFactoryTest, InvalidTextIsRejected) {
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/")));
+    EXPECT_FALSE(_endPoint->sendText("\xC0\xAF"));
+    EXPECT_FALSE(_endPoint->sendText(std::string_view("\xE2\x82", 2U)));
+    EXPECT_TRUE(_server->_listener->_texts.empty());
+    EXPECT_TRUE(_endPoint->sendText("\xE2\x82\xAC"));
+    EXPECT_EQ(std::vector<std::string>{"\xE2\x82\xAC"}, _server->_listener->_texts);
+    EXPECT_EQ(State::Connected, _endPoint->state());
+}
+
+TEST_F(InProcessFactoryTest, CloseCodesReachPeer) {
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/")));
+    // normal closure is not an error
+    _endPoint->close();
+    EXPECT_TRUE(_server->_listener->_closeErrors.empty());
+    EXPECT_EQ(State::Disconnected, _server->_endPoints.back()->state());
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/")));
+    auto& accepted = dynamic_cast<InProcessEndPoint&>(*_server->_endPoints.back());
+    accepted.close(CloseCode::TryAgainLater, "overloaded");
+    ASSERT_EQ(1U, _client->_closeErrors.size());
+    EXPECT_EQ(CloseCode::TryAgainLater, _client->_closeErrors[0]._code.value());
+    EXPECT_EQ("overloaded", _client->_closeErrors[0]._details);
+    EXPECT_EQ(State::Disconnected, _client->_states.back());
+    // destruction without closing
+    ASSERT_TRUE(_endPoint->open(inProcess("inproc://echo/")));
+    _server->_endPoints.clear();
+    ASSERT_EQ(2U, _client->_closeErrors.size());
+    EXPECT_EQ(CloseCode::GoingAway, _client->_closeErrors[1]._code.value());
+    EXPECT_EQ(State::Disconnected, _endPoint->state());
+}
+
+TEST_F(InProcessFactoryTest, AcceptorNamesAreUnique) {
+    auto other = _factory.createAcceptor();
+    AcceptorOptions options;
+    options._address = "inproc://echo";
+    EXPECT_FALSE(other->start(options, _server));
+    _acceptor->stop();
+    EXPECT_TRUE(other->start(options, _server));
+    // acceptors of another factory are not visible
+    InProcessFactory factory;
+    auto endPoint = factory.create();
+    EXPECT_FALSE(endPoint->open(inProcess("inproc://echo/")));
+}
+
+} // namespace Websocket
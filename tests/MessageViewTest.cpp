@@ -0,0 +1,126 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketMessageView.h"
+#include "BytesBlob.h"
+#include "InProcessFactory.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace Websocket
+{
+
+TEST(MessageViewTest, BraceInitializedFromStrings) {
+    const std::string first = "first", second = "second";
+    const std::vector<MessageView> views{first, second};
+    ASSERT_EQ(2U, views.size());
+    EXPECT_FALSE(views[0].binary());
+    EXPECT_EQ(first.data(), views[0]._text.data());
+    EXPECT_EQ("second", views[1]._text);
+}
+
+TEST(MessageViewTest, MixedPayloads) {
+    const std::string text = "text";
+    const BytesBlob blob(std::string_view("\x01\x02"));
+    const std::vector<MessageView> views{text, "literal", std::string_view("view"), blob};
+    ASSERT_EQ(4U, views.size());
+    EXPECT_EQ("literal", views[1]._text);
+    EXPECT_EQ("view", views[2]._text);
+    EXPECT_TRUE(views[3].binary());
+    EXPECT_EQ(&blob, views[3]._binary);
+}
+
+TEST(MessageViewTest, NullTextIsEmpty) {
+    const char* text = nullptr;
+    const MessageView view(text);
+    EXPECT_FALSE(view.binary());
+    EXPECT_TRUE(view._text.empty());
+}
+
+TEST(MessageViewTest, SharedBinary) {
+    auto blob = std::make_shared<const BytesBlob>(std::string_view("\x01"));
+    const MessageView view(blob);
+    EXPECT_TRUE(view.binary());
+    EXPECT_EQ(blob.get(), view._binary);
+    EXPECT_EQ(blob, view._sharedBinary);
+    const MessageView empty(std::shared_ptr<const Bricks::Blob>{});
+    EXPECT_FALSE(empty.binary());
+    EXPECT_TRUE(empty._text.empty());
+}
+
+TEST(MessageViewTest, DefaultBatchDeliveryKeepsSharedPayloads) {
+    class SharedListener : public Listener
+    {
+    public:
+        std::vector<std::shared_ptr<const Bricks::Blob>> _shared;
+        size_t _borrowed = 0U;
+        std::vector<std::string> _texts;
+        void onTextMessage(uint64_t, uint64_t, const std::string_view& message) final {
+            _texts.emplace_back(message);
+        }
+        void onBinaryMessage(uint64_t, uint64_t, const Bricks::Blob&) final { ++_borrowed; }
+        void onSharedBinaryMessage(uint64_t, uint64_t, std::shared_ptr<const Bricks::Blob> message) final {
+            _shared.push_back(std::move(message));
+        }
+    } listener;
+    const auto shared = std::make_shared<const BytesBlob>(std::string_view("shared"));
+    const BytesBlob borrowed(std::string_view("borrowed"));
+    const std::vector<MessageView> batch{"text", MessageView(shared), borrowed};
+    listener.onMessageBatch(1U, 2U, batch.data(), batch.size());
+    EXPECT_EQ(std::vector<std::string>{"text"}, listener._texts);
+    ASSERT_EQ(1U, listener._shared.size());
+    EXPECT_EQ(shared, listener._shared.front());
+    EXPECT_EQ(1U, listener._borrowed);
+}
+
+TEST(MessageViewTest, DefaultBatchSendSharesPayloads) {
+    class Server : public AcceptorListener
+    {
+    public:
+        class Recorder : public Listener
+        {
+        public:
+            std::vector<std::shared_ptr<const Bricks::Blob>> _binaries;
+            void onSharedBinaryMessage(uint64_t, uint64_t, std::shared_ptr<const Bricks::Blob> message) final {
+                _binaries.push_back(std::move(message));
+            }
+        };
+        std::shared_ptr<Recorder> _recorder = std::make_shared<Recorder>();
+        std::unique_ptr<EndPoint> _endPoint;
+        void onAccepted(std::unique_ptr<EndPoint> endPoint, uint64_t) final {
+            endPoint->setListener(_recorder);
+            _endPoint = std::move(endPoint);
+        }
+    };
+    InProcessFactory factory;
+    const auto server = std::make_shared<Server>();
+    const auto acceptor = factory.createAcceptor();
+    AcceptorOptions acceptorOptions;
+    acceptorOptions._address = "inproc://batch";
+    ASSERT_TRUE(acceptor->start(std::move(acceptorOptions), server));
+    const auto client = factory.create();
+    Options options;
+    options._host = "inproc://batch/";
+    ASSERT_TRUE(client->open(std::move(options)));
+    const auto shared = std::make_shared<const BytesBlob>(std::string_view("shared"));
+    const BytesBlob borrowed(std::string_view("borrowed"));
+    const std::vector<MessageView> batch{MessageView(shared), borrowed};
+    EXPECT_EQ(2U, client->sendBatch(batch.data(), batch.size()));
+    const auto& received = server->_recorder->_binaries;
+    ASSERT_EQ(2U, received.size());
+    // the shared payload is passed by reference, the borrowed one is copied
+    EXPECT_EQ(shared, received[0]);
+    EXPECT_NE(&borrowed, received[1].get());
+}
+
+} // namespace Websocket
@@ -0,0 +1,127 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketMpscRing.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace Websocket
+{
+
+namespace {
+
+struct Item
+{
+    uint32_t _producer = 0U;
+    uint32_t _sequence = 0U;
+};
+
+// pushes [count] items from each of [producers] threads, while the calling thread
+// consumes them by [pop], verifies that items of every producer arrive in order
+template <class Pop>
+void expectProducerOrder(MpscRing<Item>& ring, uint32_t producers, uint32_t count, Pop pop) {
+    std::vector<std::thread> threads;
+    for (uint32_t producer = 0U; producer < producers; ++producer) {
+        threads.emplace_back([&ring, producer, count]() {
+            for (uint32_t sequence = 0U; sequence < count; ++sequence) {
+                Item item{producer, sequence};
+                while (!ring.tryPush(std::move(item))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<uint32_t> next(producers, 0U);
+    size_t received = 0U;
+    const auto expected = size_t(producers) * count;
+    while (received < expected) {
+        const auto popped = pop([&](Item&& item) {
+            ASSERT_LT(item._producer, producers);
+            ASSERT_EQ(next[item._producer], item._sequence) << "producer " << item._producer;
+            ++next[item._producer];
+        });
+        if (0U == popped) {
+            std::this_thread::yield();
+        }
+        received += popped;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Item item;
+    EXPECT_FALSE(ring.tryPop(item));
+    for (uint32_t producer = 0U; producer < producers; ++producer) {
+        EXPECT_EQ(count, next[producer]);
+    }
+}
+
+} // namespace
+
+TEST(MpscRingTest, CapacityIsRoundedUp) {
+    EXPECT_EQ(2U, MpscRing<int>(0U).capacity());
+    EXPECT_EQ(8U, MpscRing<int>(5U).capacity());
+    EXPECT_EQ(64U, MpscRing<int>(64U).capacity());
+}
+
+TEST(MpscRingTest, FifoAndFull) {
+    MpscRing<std::unique_ptr<int>> ring(4U);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.tryPush(std::make_unique<int>(i)));
+    }
+    auto rejected = std::make_unique<int>(4);
+    EXPECT_FALSE(ring.tryPush(std::move(rejected)));
+    ASSERT_TRUE(rejected); // left untouched
+    std::unique_ptr<int> value;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(i, *value);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+    // wrap around
+    EXPECT_TRUE(ring.tryPush(std::move(rejected)));
+    ASSERT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(4, *value);
+}
+
+TEST(MpscRingTest, PopBatchRespectsLimit) {
+    MpscRing<int> ring(8U);
+    for (int i = 0; i < 6; ++i) {
+        ring.tryPush(int(i));
+    }
+    std::vector<int> values;
+    EXPECT_EQ(4U, ring.popBatch([&](int&& value) { values.push_back(value); }, 4U));
+    EXPECT_EQ(2U, ring.popBatch([&](int&& value) { values.push_back(value); }));
+    EXPECT_EQ(0U, ring.popBatch([&](int&& value) { values.push_back(value); }));
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5}), values);
+}
+
+TEST(MpscRingTest, MultiProducerOrderByPop) {
+    MpscRing<Item> ring(64U);
+    expectProducerOrder(ring, 4U, 50000U, [&ring](auto&& check) {
+        Item item;
+        if (ring.tryPop(item)) {
+            check(std::move(item));
+            return size_t(1U);
+        }
+        return size_t(0U);
+    });
+}
+
+TEST(MpscRingTest, MultiProducerOrderByBatches) {
+    // small ring, producers hit the full ring constantly
+    MpscRing<Item> ring(8U);
+    expectProducerOrder(ring, 8U, 20000U, [&ring](auto&& check) { return ring.popBatch(check, 5U); });
+}
+
+} // namespace Websocket
@@ -0,0 +1,85 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketPreparedMessage.h"
+#include "FrameRecorder.h"
+#include <gtest/gtest.h>
+
+namespace Websocket
+{
+
+namespace {
+
+const uint8_t* bytes(std::string_view text) {
+    return reinterpret_cast<const uint8_t*>(text.data());
+}
+
+// decodes the prepared frame as a client would receive it
+std::vector<std::string> decode(const PreparedMessage& message) {
+    std::vector<uint8_t> frame(message.data(), message.data() + message.size());
+    FrameRecorder recorder;
+    FrameDecoder decoder(recorder, false, 0U, true);
+    decoder.decode(frame.data(), frame.size());
+    return recorder._events;
+}
+
+} // namespace
+
+TEST(PreparedMessageTest, TextFrame) {
+    const auto message = PreparedMessage::text("hello");
+    ASSERT_TRUE(message);
+    EXPECT_EQ(Opcode::Text, message->opcode());
+    EXPECT_FALSE(message->compressed());
+    EXPECT_EQ(7U, message->size());
+    EXPECT_EQ(5U, message->payloadSize());
+    EXPECT_EQ("hello", std::string_view(reinterpret_cast<const char*>(message->payload()), 5U));
+    EXPECT_EQ(std::vector<std::string>{"text+-:hello"}, decode(*message));
+}
+
+TEST(PreparedMessageTest, BinaryFrame) {
+    const std::string payload(300U, '\xFF');
+    const auto message = PreparedMessage::binary(bytes(payload), payload.size());
+    ASSERT_TRUE(message);
+    EXPECT_EQ(Opcode::Binary, message->opcode());
+    EXPECT_EQ(payload.size() + 4U, message->size());
+    EXPECT_EQ(std::vector<std::string>{"binary+-:" + payload}, decode(*message));
+    const auto empty = PreparedMessage::binary(nullptr, 10U);
+    ASSERT_TRUE(empty);
+    EXPECT_EQ(0U, empty->payloadSize());
+}
+
+TEST(PreparedMessageTest, ControlFrames) {
+    const std::string payload(FrameCodec::MaxControlPayloadSize, 'p');
+    const auto ping = PreparedMessage::create(Opcode::Ping, bytes(payload), payload.size());
+    ASSERT_TRUE(ping);
+    EXPECT_EQ(std::vector<std::string>{"ping:" + payload}, decode(*ping));
+    EXPECT_TRUE(PreparedMessage::create(Opcode::Pong, nullptr, 0U));
+    EXPECT_FALSE(PreparedMessage::create(Opcode::Ping, bytes(payload + "p"), payload.size() + 1U));
+    EXPECT_FALSE(PreparedMessage::create(Opcode::Pong, bytes("x"), 1U, true));
+}
+
+TEST(PreparedMessageTest, InvalidFramesAreRefused) {
+    EXPECT_FALSE(PreparedMessage::create(Opcode::Continuation, bytes("x"), 1U));
+    EXPECT_FALSE(PreparedMessage::create(Opcode::Close, bytes("\x03\xE8"), 2U));
+    EXPECT_FALSE(PreparedMessage::create(static_cast<Opcode>(0x3U), bytes("x"), 1U));
+    EXPECT_FALSE(PreparedMessage::text("\xC0\xAF"));
+    // deflated text is not UTF-8
+    EXPECT_TRUE(PreparedMessage::create(Opcode::Text, bytes("\xC0\xAF"), 2U, true));
+}
+
+TEST(PreparedMessageTest, BroadcastSkipsRefusedMessage) {
+    std::vector<EndPoint*> endpoints(3U, nullptr);
+    EXPECT_EQ(0U, broadcast(endpoints.begin(), endpoints.end(), PreparedMessage::text("\xFF")));
+}
+
+} // namespace Websocket
@@ -0,0 +1,138 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketReconnect.h"
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace Websocket
+{
+
+namespace {
+
+ReconnectPolicy fixedPolicy() {
+    ReconnectPolicy policy;
+    policy._initialDelay = std::chrono::milliseconds(100);
+    policy._maxDelay = std::chrono::seconds(30);
+    policy._multiplier = 2.;
+    policy._jitter = false;
+    return policy;
+}
+
+} // namespace
+
+TEST(ReconnectTest, ExponentialDelay) {
+    const auto policy = fixedPolicy();
+    std::mt19937_64 generator;
+    EXPECT_EQ(100, reconnectDelay(policy, 0U, generator).count());
+    EXPECT_EQ(200, reconnectDelay(policy, 1U, generator).count());
+    EXPECT_EQ(1600, reconnectDelay(policy, 4U, generator).count());
+    EXPECT_EQ(25600, reconnectDelay(policy, 8U, generator).count());
+    EXPECT_EQ(30000, reconnectDelay(policy, 9U, generator).count());
+}
+
+TEST(ReconnectTest, DelayIsClampedForAnyAttempt) {
+    auto policy = fixedPolicy();
+    std::mt19937_64 generator;
+    // closed form: huge attempt indices take constant time and don't overflow
+    EXPECT_EQ(30000, reconnectDelay(policy, std::numeric_limits<uint32_t>::max(), generator).count());
+    policy._multiplier = 1e300;
+    EXPECT_EQ(30000, reconnectDelay(policy, 1000U, generator).count());
+    policy._multiplier = 0.5;
+    EXPECT_EQ(100, reconnectDelay(policy, 10U, generator).count());
+    policy._initialDelay = std::chrono::minutes(1);
+    EXPECT_EQ(30000, reconnectDelay(policy, 0U, generator).count());
+    policy._initialDelay = {};
+    EXPECT_EQ(0, reconnectDelay(policy, 5U, generator).count());
+}
+
+TEST(ReconnectTest, JitterStaysBelowBound) {
+    auto policy = fixedPolicy();
+    policy._jitter = true;
+    std::mt19937_64 generator(42U);
+    bool varies = false;
+    for (int i = 0; i < 1000; ++i) {
+        const auto delay = reconnectDelay(policy, 3U, generator).count();
+        EXPECT_GE(delay, 0);
+        EXPECT_LE(delay, 800);
+        varies = varies || delay != 800;
+    }
+    EXPECT_TRUE(varies);
+}
+
+TEST(ReconnectTest, ScheduleCountsStartedAttempts) {
+    auto policy = fixedPolicy();
+    policy._maxAttempts = 2U;
+    ReconnectSchedule schedule(policy);
+    EXPECT_EQ(100, schedule.nextDelay().count());
+    ASSERT_TRUE(schedule.tryBegin());
+    EXPECT_FALSE(schedule.tryBegin());
+    schedule.onFailed();
+    EXPECT_EQ(200, schedule.nextDelay().count());
+    ASSERT_TRUE(schedule.tryBegin());
+    EXPECT_FALSE(schedule.exhausted());
+    schedule.onFailed();
+    EXPECT_TRUE(schedule.exhausted());
+    EXPECT_FALSE(schedule.tryBegin());
+    EXPECT_EQ(2U, schedule.attempts());
+}
+
+TEST(ReconnectTest, SuccessResetsBackoff) {
+    auto policy = fixedPolicy();
+    policy._maxAttempts = 2U;
+    ReconnectSchedule schedule(policy);
+    ASSERT_TRUE(schedule.tryBegin());
+    schedule.onFailed();
+    ASSERT_TRUE(schedule.tryBegin());
+    schedule.onSucceeded();
+    EXPECT_EQ(0U, schedule.attempts());
+    EXPECT_FALSE(schedule.exhausted());
+    EXPECT_EQ(100, schedule.nextDelay().count());
+}
+
+TEST(ReconnectTest, LimiterWaitsDontConsumeAttempts) {
+    auto policy = fixedPolicy();
+    policy._maxAttempts = 1U;
+    policy._handshakeLimiter = std::make_shared<HandshakeLimiter>(1U);
+    ReconnectSchedule first(policy), second(policy);
+    ASSERT_TRUE(first.tryBegin());
+    EXPECT_EQ(1U, policy._handshakeLimiter->active());
+    // the only slot is taken: the second endpoint keeps waiting with the same backoff
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_FALSE(second.tryBegin());
+        EXPECT_EQ(100, second.nextDelay().count());
+    }
+    EXPECT_EQ(10U, second.postponed());
+    EXPECT_EQ(0U, second.attempts());
+    EXPECT_FALSE(second.exhausted());
+    first.onSucceeded();
+    EXPECT_EQ(0U, policy._handshakeLimiter->active());
+    ASSERT_TRUE(second.tryBegin());
+    EXPECT_EQ(1U, second.attempts());
+    second.onFailed();
+    EXPECT_TRUE(second.exhausted());
+    EXPECT_EQ(0U, policy._handshakeLimiter->active());
+}
+
+TEST(ReconnectTest, DestructionReturnsSlot) {
+    auto policy = fixedPolicy();
+    policy._handshakeLimiter = std::make_shared<HandshakeLimiter>(1U);
+    {
+        ReconnectSchedule schedule(policy);
+        ASSERT_TRUE(schedule.tryBegin());
+        EXPECT_EQ(1U, policy._handshakeLimiter->active());
+    }
+    EXPECT_EQ(0U, policy._handshakeLimiter->active());
+}
+
+} // namespace Websocket
@@ -0,0 +1,74 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketFactory.h"
+#include "WebsocketScheme.h"
+#include <gtest/gtest.h>
+
+namespace Websocket
+{
+
+TEST(SchemeTest, SchemeOf) {
+    EXPECT_EQ(Scheme::Ws, schemeOf("ws://example.com/"));
+    EXPECT_EQ(Scheme::Wss, schemeOf("WSS://example.com/"));
+    EXPECT_EQ(Scheme::Unix, schemeOf("ws+unix:///run/app.sock"));
+    EXPECT_EQ(Scheme::SecureUnix, schemeOf("wss+unix:///run/app.sock:/"));
+    EXPECT_EQ(Scheme::Unknown, schemeOf("example.com:8080"));
+    EXPECT_EQ(Scheme::Unknown, schemeOf("http://example.com/"));
+}
+
+TEST(SchemeTest, DefaultFactorySupportsHostsWithoutScheme) {
+    class NetworkFactory : public Factory
+    {
+    public:
+        std::unique_ptr<EndPoint> create() const final { return nullptr; }
+    } factory;
+    EXPECT_TRUE(factory.supportsScheme(schemeOf("example.com:8080")));
+    EXPECT_TRUE(factory.supportsScheme(Scheme::Ws));
+    EXPECT_TRUE(factory.supportsScheme(Scheme::Wss));
+    EXPECT_FALSE(factory.supportsScheme(Scheme::InProcess));
+    EXPECT_FALSE(factory.supportsScheme(Scheme::Unix));
+}
+
+TEST(SchemeTest, InProcessUrl) {
+    EXPECT_EQ(Scheme::InProcess, schemeOf("INPROC://name/x"));
+    EXPECT_EQ("name", inProcessName("inproc://name/stream?a=b"));
+    EXPECT_EQ("/stream?a=b", inProcessResource("inproc://name/stream?a=b"));
+    EXPECT_EQ("name", inProcessName("inproc://name"));
+    EXPECT_EQ("/", inProcessResource("inproc://name"));
+    EXPECT_EQ("", inProcessName("ws://name/"));
+}
+
+
+TEST(SchemeTest, UnixUrl) {
+    EXPECT_EQ("/run/app.sock", unixSocketPath("ws+unix:///run/app.sock:/stream"));
+    EXPECT_EQ("/stream", unixResource("ws+unix:///run/app.sock:/stream"));
+    EXPECT_EQ("/run/app.sock", unixSocketPath("wss+unix:///run/app.sock"));
+    EXPECT_EQ("/", unixResource("wss+unix:///run/app.sock"));
+    EXPECT_EQ("/run/app.sock", unixSocketPath("ws+unix:///run/app.sock:"));
+    EXPECT_EQ("/", unixResource("ws+unix:///run/app.sock:"));
+    EXPECT_EQ("", unixSocketPath("ws://run/app.sock:/stream"));
+    EXPECT_EQ("/", unixResource("ws://run/app.sock:/stream"));
+}
+
+TEST(SchemeTest, UnixPathWithColons) {
+    EXPECT_EQ("/run/a:b.sock", unixSocketPath("ws+unix:///run/a:b.sock:/x:y"));
+    EXPECT_EQ("/x:y", unixResource("ws+unix:///run/a:b.sock:/x:y"));
+    EXPECT_EQ("/run/node:1:2/app.sock", unixSocketPath("ws+unix:///run/node:1:2%2Fapp.sock:/"));
+    // `:/` inside the path must be percent-encoded
+    EXPECT_EQ("/run/a:/b.sock", unixSocketPath("ws+unix:///run/a%3A/b.sock:/stream"));
+    EXPECT_EQ("/stream", unixResource("ws+unix:///run/a%3A/b.sock:/stream"));
+    EXPECT_EQ("/run/a b%zz%4", unixSocketPath("ws+unix:///run/a%20b%zz%4"));
+}
+
+} // namespace Websocket
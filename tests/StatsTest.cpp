@@ -0,0 +1,120 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketStats.h"
+#include <gtest/gtest.h>
+#include <locale>
+
+namespace Websocket
+{
+
+namespace {
+
+size_t occurrences(const std::string& text, std::string_view pattern) {
+    size_t count = 0U;
+    for (auto pos = text.find(pattern); std::string::npos != pos; pos = text.find(pattern, pos + 1U)) {
+        ++count;
+    }
+    return count;
+}
+
+// numeric punctuation of e.g. de_DE, without dependency on installed locales
+class CommaPunct : public std::numpunct<char>
+{
+protected:
+    char do_decimal_point() const final { return ','; }
+    char do_thousands_sep() const final { return '.'; }
+    std::string do_grouping() const final { return "\3"; }
+};
+
+} // namespace
+
+TEST(StatsTest, SingleSeries) {
+    Stats stats;
+    stats._bytesIn = 1234567U;
+    stats._handshakeDuration.add(std::chrono::microseconds(3));
+    stats._handshakeDuration.add(std::chrono::microseconds(1500000));
+    const auto text = toPrometheus(stats, "host=\"a\"");
+    EXPECT_NE(std::string::npos, text.find("websocket_received_bytes_total{host=\"a\"} 1234567\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_handshake_duration_seconds_bucket{host=\"a\",le=\"0.000003\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_handshake_duration_seconds_bucket{host=\"a\",le=\"2.097151\"} 2\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_handshake_duration_seconds_bucket{host=\"a\",le=\"+Inf\"} 2\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_handshake_duration_seconds_sum{host=\"a\"} 1.500003\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_handshake_duration_seconds_count{host=\"a\"} 2\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_ping_rtt_seconds_sum{host=\"a\"} 0\n"));
+}
+
+TEST(StatsTest, UnlabeledSeries) {
+    const auto text = toPrometheus(Stats());
+    EXPECT_NE(std::string::npos, text.find("websocket_sent_frames_total 0\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_ping_rtt_seconds_bucket{le=\"0\"} 0\n"));
+}
+
+TEST(StatsTest, BucketBoundsAreInclusive) {
+    Stats stats;
+    stats._pingRtt.add(std::chrono::microseconds(4));
+    const auto text = toPrometheus(stats);
+    EXPECT_NE(std::string::npos, text.find("websocket_ping_rtt_seconds_bucket{le=\"0.000003\"} 0\n"));
+    EXPECT_NE(std::string::npos, text.find("websocket_ping_rtt_seconds_bucket{le=\"0.000007\"} 1\n"));
+}
+
+TEST(StatsTest, CounterGroupsDoNotShareCacheLines) {
+    EXPECT_GE(alignof(StatsCounters), 64U);
+    EXPECT_GE(sizeof(StatsCounters), 3U * 64U);
+}
+
+TEST(StatsTest, FamiliesAreDescribedOnce) {
+    std::vector<LabeledStats> series(3U);
+    series[0]._labels = "host=\"a\"";
+    series[1]._labels = "host=\"b\"";
+    series[2]._labels = "host=\"c\"";
+    series[1]._stats._framesOut = 7U;
+    const auto text = toPrometheus(series);
+    EXPECT_EQ(1U, occurrences(text, "# HELP websocket_sent_frames_total "));
+    EXPECT_EQ(1U, occurrences(text, "# TYPE websocket_sent_frames_total counter\n"));
+    EXPECT_EQ(1U, occurrences(text, "# TYPE websocket_ping_rtt_seconds histogram\n"));
+    EXPECT_EQ(3U, occurrences(text, "websocket_sent_frames_total{"));
+    EXPECT_NE(std::string::npos, text.find("websocket_sent_frames_total{host=\"b\"} 7\n"));
+    // samples of a family are contiguous and follow its description
+    const auto help = text.find("# HELP websocket_sent_frames_total ");
+    const auto last = text.find("websocket_sent_frames_total{host=\"c\"}");
+    EXPECT_LT(help, last);
+    EXPECT_EQ(std::string::npos, text.substr(help, last - help).find("# HELP websocket_received_frames_total"));
+}
+
+TEST(StatsTest, IndependentOfGlobalLocale) {
+    Stats stats;
+    stats._bytesOut = 1234567U;
+    stats._pingRtt.add(std::chrono::microseconds(2500));
+    const auto expected = toPrometheus(stats);
+    const auto previous = std::locale::global(std::locale(std::locale::classic(), new CommaPunct));
+    const auto actual = toPrometheus(stats);
+    std::locale::global(previous);
+    EXPECT_EQ(expected, actual);
+    EXPECT_NE(std::string::npos, actual.find("websocket_sent_bytes_total 1234567\n"));
+    EXPECT_NE(std::string::npos, actual.find("websocket_ping_rtt_seconds_sum 0.0025\n"));
+}
+
+TEST(StatsTest, Percentile) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.percentile(50.).count());
+    for (int i = 0; i < 99; ++i) {
+        histogram.add(std::chrono::microseconds(10));
+    }
+    histogram.add(std::chrono::microseconds(5000));
+    EXPECT_EQ(16, histogram.percentile(50.).count());
+    EXPECT_EQ(16, histogram.percentile(99.).count());
+    EXPECT_EQ(8192, histogram.percentile(100.).count());
+}
+
+} // namespace Websocket
@@ -0,0 +1,211 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketTimerWheel.h"
+#include <gtest/gtest.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Websocket
+{
+
+namespace {
+
+using std::chrono::microseconds;
+
+constexpr uint64_t maxTicks = (uint64_t(1) << 32U) - 1U;
+
+class TestTimer : public TimerWheel::Timer
+{
+public:
+    size_t _fired = 0U;
+    std::function<void()> _callback;
+
+protected:
+    // impl. of TimerWheel::Timer
+    void onTimer() final {
+        ++_fired;
+        if (_callback) {
+            _callback();
+        }
+    }
+};
+
+// wheel with 1 microsecond ticks, so that delays & time points are counted in ticks
+class TickWheel : public TimerWheel
+{
+public:
+    TickWheel() : TimerWheel(microseconds(1), std::chrono::steady_clock::time_point()) {}
+    size_t advanceTo(uint64_t tick) {
+        return advance(std::chrono::steady_clock::time_point() + microseconds(tick));
+    }
+    void schedule(TestTimer& timer, uint64_t ticks) {
+        TimerWheel::schedule(timer, microseconds(ticks));
+    }
+};
+
+} // namespace
+
+TEST(TimerWheelTest, FiresExactlyAtDeadlineAcrossLevels) {
+    for (const uint64_t start : {0U, 1U, 200U, 65530U}) {
+        for (const uint64_t delay : {1U, 255U, 256U, 257U, 65535U, 65536U, 65537U, 16777216U + 3U}) {
+            TickWheel wheel;
+            wheel.advanceTo(start);
+            TestTimer timer;
+            wheel.schedule(timer, delay);
+            EXPECT_EQ(0U, wheel.advanceTo(start + delay - 1U)) << start << '+' << delay;
+            EXPECT_EQ(0U, timer._fired) << start << '+' << delay;
+            EXPECT_EQ(1U, wheel.advanceTo(start + delay)) << start << '+' << delay;
+            EXPECT_EQ(1U, timer._fired) << start << '+' << delay;
+            EXPECT_FALSE(timer.scheduled());
+            EXPECT_EQ(0U, wheel.size());
+        }
+    }
+}
+
+TEST(TimerWheelTest, TimersOfAllLevelsFireInOrder) {
+    const std::vector<uint64_t> delays = {3U, 255U, 256U, 300U, 65535U, 65536U, 70000U, 16777216U, 20000000U};
+    TickWheel wheel;
+    std::vector<TestTimer> timers(delays.size());
+    std::vector<size_t> order;
+    for (size_t i = 0U; i < delays.size(); ++i) {
+        timers[i]._callback = [&order, i]() { order.push_back(i); };
+        wheel.schedule(timers[i], delays[i]);
+    }
+    EXPECT_EQ(delays.size(), wheel.size());
+    for (size_t i = 0U; i < delays.size(); ++i) {
+        EXPECT_EQ(0U, wheel.advanceTo(delays[i] - 1U)) << delays[i];
+        EXPECT_EQ(1U, wheel.advanceTo(delays[i])) << delays[i];
+        EXPECT_EQ(i + 1U, order.size());
+        EXPECT_EQ(i, order.back());
+    }
+    EXPECT_EQ(0U, wheel.size());
+}
+
+TEST(TimerWheelTest, DelaysAreRoundedUpToTicks) {
+    TimerWheel wheel(std::chrono::milliseconds(10), std::chrono::steady_clock::time_point());
+    TestTimer timer, immediate;
+    wheel.schedule(timer, std::chrono::milliseconds(15));
+    wheel.schedule(immediate, microseconds(0));
+    const auto start = std::chrono::steady_clock::time_point();
+    EXPECT_EQ(1U, wheel.advance(start + std::chrono::milliseconds(10)));
+    EXPECT_EQ(1U, immediate._fired);
+    EXPECT_EQ(0U, wheel.advance(start + std::chrono::milliseconds(19)));
+    EXPECT_EQ(1U, wheel.advance(start + std::chrono::milliseconds(20)));
+    EXPECT_EQ(1U, timer._fired);
+}
+
+TEST(TimerWheelTest, LongDelaysAreClamped) {
+    TickWheel wheel;
+    TestTimer longest, clamped;
+    wheel.schedule(longest, maxTicks);
+    // doesn't overflow while rounding up
+    wheel.TimerWheel::schedule(clamped, microseconds::max());
+    EXPECT_EQ(2U, wheel.size());
+    EXPECT_EQ(0U, wheel.advanceTo(maxTicks - 1U));
+    EXPECT_EQ(2U, wheel.advanceTo(maxTicks));
+    EXPECT_EQ(1U, longest._fired);
+    EXPECT_EQ(1U, clamped._fired);
+}
+
+TEST(TimerWheelTest, CancelBeforeFire) {
+    TickWheel wheel;
+    TestTimer cancelled, kept, far;
+    wheel.schedule(cancelled, 10U);
+    wheel.schedule(kept, 10U);
+    wheel.schedule(far, 70000U);
+    cancelled.cancel();
+    far.cancel();
+    EXPECT_FALSE(cancelled.scheduled());
+    EXPECT_EQ(1U, wheel.size());
+    EXPECT_EQ(1U, wheel.advanceTo(100000U));
+    EXPECT_EQ(0U, cancelled._fired);
+    EXPECT_EQ(1U, kept._fired);
+    EXPECT_EQ(0U, far._fired);
+    EXPECT_EQ(0U, wheel.size());
+    // cancelling of an expired timer is a no-op
+    kept.cancel();
+    EXPECT_EQ(0U, wheel.size());
+}
+
+TEST(TimerWheelTest, CancelFromCallbackOfAnotherTimer) {
+    TickWheel wheel;
+    TestTimer first, second;
+    first._callback = [&second]() { second.cancel(); };
+    second._callback = [&first]() { first.cancel(); };
+    wheel.schedule(first, 5U);
+    wheel.schedule(second, 5U);
+    EXPECT_EQ(1U, wheel.advanceTo(5U));
+    EXPECT_EQ(1U, first._fired + second._fired);
+    EXPECT_EQ(0U, wheel.size());
+}
+
+TEST(TimerWheelTest, RescheduleArmedTimer) {
+    TickWheel wheel;
+    TestTimer timer;
+    wheel.schedule(timer, 100U);
+    EXPECT_EQ(0U, wheel.advanceTo(50U));
+    // moves the timer from level 0 to level 1
+    wheel.schedule(timer, 300U);
+    EXPECT_EQ(1U, wheel.size());
+    EXPECT_EQ(0U, wheel.advanceTo(349U));
+    EXPECT_EQ(0U, timer._fired);
+    EXPECT_EQ(1U, wheel.advanceTo(350U));
+    // and back to a closer deadline
+    wheel.schedule(timer, 70000U);
+    wheel.schedule(timer, 2U);
+    EXPECT_EQ(1U, wheel.size());
+    EXPECT_EQ(1U, wheel.advanceTo(352U));
+    EXPECT_EQ(2U, timer._fired);
+    EXPECT_EQ(0U, wheel.advanceTo(100000U));
+}
+
+TEST(TimerWheelTest, RescheduleFromCallback) {
+    TickWheel wheel;
+    TestTimer timer;
+    timer._callback = [&wheel, &timer]() { wheel.schedule(timer, 256U); };
+    wheel.schedule(timer, 256U);
+    EXPECT_EQ(4U, wheel.advanceTo(1024U));
+    EXPECT_TRUE(timer.scheduled());
+    EXPECT_EQ(1U, wheel.size());
+    EXPECT_EQ(0U, wheel.advanceTo(1279U));
+    EXPECT_EQ(1U, wheel.advanceTo(1280U));
+}
+
+TEST(TimerWheelTest, DestroyWheelWithArmedTimers) {
+    TestTimer near, far;
+    {
+        auto wheel = std::make_unique<TickWheel>();
+        wheel->schedule(near, 1U);
+        wheel->schedule(far, 100000000U);
+        EXPECT_EQ(2U, wheel->size());
+    }
+    EXPECT_FALSE(near.scheduled());
+    EXPECT_FALSE(far.scheduled());
+    near.cancel();
+    EXPECT_EQ(0U, near._fired + far._fired);
+}
+
+TEST(TimerWheelTest, DestroyTimerBeforeWheel) {
+    TickWheel wheel;
+    {
+        TestTimer timer;
+        wheel.schedule(timer, 10U);
+        EXPECT_EQ(1U, wheel.size());
+    }
+    EXPECT_EQ(0U, wheel.size());
+    EXPECT_EQ(0U, wheel.advanceTo(20U));
+}
+
+} // namespace Websocket
@@ -0,0 +1,127 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketTlsSessionCache.h"
+#include <gtest/gtest.h>
+
+namespace Websocket
+{
+
+namespace {
+
+std::vector<uint8_t> session(uint8_t id) {
+    return {id};
+}
+
+} // namespace
+
+TEST(TlsSessionCacheTest, TakeRemovesSession) {
+    TlsSessionCache cache;
+    cache.store("a", session(1U));
+    EXPECT_EQ(1U, cache.size());
+    EXPECT_EQ(session(1U), cache.take("a"));
+    EXPECT_TRUE(cache.take("a").empty());
+    EXPECT_EQ(0U, cache.size());
+    cache.store("a", {});
+    EXPECT_EQ(0U, cache.size());
+}
+
+TEST(TlsSessionCacheTest, QueuePerKey) {
+    TlsSessionCache cache(0U, 3U);
+    for (uint8_t id = 1U; id <= 4U; ++id) {
+        cache.store("a", session(id));
+    }
+    // the oldest ticket is dropped, the freshest is taken first
+    EXPECT_EQ(3U, cache.size());
+    EXPECT_EQ(session(4U), cache.take("a"));
+    EXPECT_EQ(session(3U), cache.take("a"));
+    EXPECT_EQ(session(2U), cache.take("a"));
+    EXPECT_TRUE(cache.take("a").empty());
+}
+
+TEST(TlsSessionCacheTest, EvictsLeastRecentlyUsed) {
+    TlsSessionCache cache(3U, 0U);
+    cache.store("a", session(1U));
+    cache.store("b", session(2U));
+    cache.store("c", session(3U));
+    // 'a' becomes the most recently used
+    cache.store("a", session(4U));
+    EXPECT_EQ(3U, cache.size());
+    // the oldest session of 'b' is evicted
+    EXPECT_TRUE(cache.take("b").empty());
+    EXPECT_EQ(session(3U), cache.take("c"));
+    EXPECT_EQ(session(4U), cache.take("a"));
+    EXPECT_EQ(session(1U), cache.take("a"));
+    EXPECT_EQ(0U, cache.size());
+    // the least recently used key loses the oldest session only
+    cache.store("a", session(5U));
+    cache.store("a", session(6U));
+    cache.store("b", session(7U));
+    cache.store("c", session(8U));
+    EXPECT_EQ(3U, cache.size());
+    EXPECT_EQ(session(6U), cache.take("a"));
+    EXPECT_TRUE(cache.take("a").empty());
+}
+
+TEST(TlsSessionCacheTest, Remove) {
+    TlsSessionCache cache;
+    cache.store("a", session(1U));
+    cache.store("a", session(2U));
+    cache.store("b", session(3U));
+    cache.remove("a");
+    EXPECT_EQ(1U, cache.size());
+    EXPECT_TRUE(cache.take("a").empty());
+    EXPECT_EQ(session(3U), cache.take("b"));
+}
+
+TEST(TlsSessionCacheTest, Stats) {
+    TlsSessionCache cache;
+    EXPECT_EQ(0., cache.stats().resumptionRate());
+    cache.reportHandshake(false);
+    cache.reportHandshake(true);
+    cache.reportHandshake(true);
+    cache.reportHandshake(true);
+    const auto stats = cache.stats();
+    EXPECT_EQ(1U, stats._fullHandshakes);
+    EXPECT_EQ(3U, stats._resumedHandshakes);
+    EXPECT_DOUBLE_EQ(0.75, stats.resumptionRate());
+}
+
+TEST(TlsSessionCacheTest, SessionKeysAreUnambiguous) {
+    Tls first, second;
+    EXPECT_EQ(TlsSessionCache::sessionKey("host", first), TlsSessionCache::sessionKey("host", second));
+    EXPECT_NE(TlsSessionCache::sessionKey("host", first), TlsSessionCache::sessionKey("other", second));
+    first._method = TlsMethod::sslv2_client; // 1
+    first._peerVerification = TlsPeerVerification::Yes;
+    second._method = TlsMethod::sslv23_server; // 11
+    second._peerVerification = TlsPeerVerification::No;
+    EXPECT_NE(TlsSessionCache::sessionKey("host", first), TlsSessionCache::sessionKey("host", second));
+    // separators inside of strings
+    first = second = Tls();
+    first._certificate = "a|1:b";
+    second._certificate = "a";
+    second._trustStore = "b";
+    EXPECT_NE(TlsSessionCache::sessionKey("host", first), TlsSessionCache::sessionKey("host", second));
+    first = second = Tls();
+    first._tlsv1_3No = true;
+    EXPECT_NE(TlsSessionCache::sessionKey("host", first), TlsSessionCache::sessionKey("host", second));
+    // host carrying the fields of another configuration
+    first = second = Tls();
+    const auto firstFields = TlsSessionCache::sessionKey("", first).substr(2U);
+    second._sslCiphers = "x" + firstFields;
+    const auto secondFields = TlsSessionCache::sessionKey("", second).substr(2U);
+    const auto craftedHost = "h" + secondFields.substr(0U, secondFields.size() - firstFields.size());
+    EXPECT_NE(TlsSessionCache::sessionKey(craftedHost, first), TlsSessionCache::sessionKey("h", second));
+}
+
+} // namespace Websocket
@@ -0,0 +1,253 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketUtf8Validator.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+namespace Websocket
+{
+
+namespace {
+
+using Kernel = size_t (*)(const uint8_t*, size_t, bool&);
+
+// validation by decoding of code points (RFC 3629), independent of the state machine,
+// returns the number of bytes in complete valid sequences, or `npos` on a malformed one
+constexpr size_t npos = std::string::npos;
+
+size_t referencePrefix(const std::string& text) {
+    const auto data = reinterpret_cast<const uint8_t*>(text.data());
+    size_t i = 0U;
+    while (i < text.size()) {
+        const uint8_t lead = data[i];
+        size_t length;
+        uint32_t codePoint, minimum;
+        if (lead < 0x80U) {
+            ++i;
+            continue;
+        }
+        if (0xC0U == (lead & 0xE0U)) {
+            length = 2U, codePoint = lead & 0x1FU, minimum = 0x80U;
+        }
+        else if (0xE0U == (lead & 0xF0U)) {
+            length = 3U, codePoint = lead & 0x0FU, minimum = 0x800U;
+        }
+        else if (0xF0U == (lead & 0xF8U)) {
+            length = 4U, codePoint = lead & 0x07U, minimum = 0x10000U;
+        }
+        else {
+            return npos;
+        }
+        size_t k = 1U;
+        for (; k < length && i + k < text.size(); ++k) {
+            if (0x80U != (data[i + k] & 0xC0U)) {
+                return npos;
+            }
+            codePoint = (codePoint << 6U) | (data[i + k] & 0x3FU);
+        }
+        if (k < length) {
+            // truncated: reject prefixes that can't be completed to a valid sequence
+            const uint32_t shift = 6U * static_cast<uint32_t>(length - k);
+            const uint32_t lowest = codePoint << shift, highest = lowest | ((1U << shift) - 1U);
+            if (highest < minimum || lowest > 0x10FFFFU || (lowest >= 0xD800U && highest <= 0xDFFFU)) {
+                return npos;
+            }
+            return i;
+        }
+        if (codePoint < minimum || codePoint > 0x10FFFFU || (codePoint >= 0xD800U && codePoint <= 0xDFFFU)) {
+            return npos;
+        }
+        i += length;
+    }
+    return i;
+}
+
+bool referenceValid(const std::string& text) {
+    return text.size() == referencePrefix(text);
+}
+
+void appendCodePoint(std::string& text, uint32_t codePoint) {
+    if (codePoint < 0x80U) {
+        text += static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800U) {
+        text += static_cast<char>(0xC0U | (codePoint >> 6U));
+        text += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+    else if (codePoint < 0x10000U) {
+        text += static_cast<char>(0xE0U | (codePoint >> 12U));
+        text += static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+        text += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+    else {
+        text += static_cast<char>(0xF0U | (codePoint >> 18U));
+        text += static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3FU));
+        text += static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+        text += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+}
+
+// random mix of 1..4 bytes sequences, with a few random byte mutations
+std::string randomText(std::mt19937& random, size_t length, size_t mutations) {
+    std::string text;
+    while (text.size() < length) {
+        uint32_t codePoint;
+        switch (random() % 5U) {
+            case 0U:
+            case 1U:
+                codePoint = random() % 0x80U;
+                break;
+            case 2U:
+                codePoint = 0x80U + random() % (0x800U - 0x80U);
+                break;
+            case 3U:
+                codePoint = 0x800U + random() % (0x10000U - 0x800U);
+                if (codePoint >= 0xD800U && codePoint <= 0xDFFFU) {
+                    codePoint -= 0x800U;
+                }
+                break;
+            default:
+                codePoint = 0x10000U + random() % (0x110000U - 0x10000U);
+                break;
+        }
+        appendCodePoint(text, codePoint);
+    }
+    for (size_t i = 0U; i < mutations && !text.empty(); ++i) {
+        text[random() % text.size()] = static_cast<char>(random());
+    }
+    return text;
+}
+
+bool validateChunked(const std::string& text, size_t chunk) {
+    Utf8Validator validator;
+    for (size_t pos = 0U; pos < text.size(); pos += chunk) {
+        if (!validator.validate(std::string_view(text).substr(pos, chunk))) {
+            return false;
+        }
+    }
+    return validator.complete();
+}
+
+// the kernel contract: malformed input within whole blocks is rejected, except lead bytes
+// of the last 3 bytes which are left to the scalar validator, otherwise the returned
+// position is the boundary of complete valid sequences
+void expectKernelMatchesReference(Kernel kernel, size_t blockSize) {
+    std::mt19937 random(7U);
+    for (size_t iteration = 0U; iteration < 20000U; ++iteration) {
+        const auto text = randomText(random, blockSize + random() % 160U, iteration % 3U);
+        const auto blocks = text.size() - text.size() % blockSize;
+        bool valid = false;
+        const auto position = kernel(reinterpret_cast<const uint8_t*>(text.data()), text.size(), valid);
+        if (!valid) {
+            ASSERT_EQ(npos, referencePrefix(text.substr(0U, blocks))) << "iteration " << iteration;
+            continue;
+        }
+        ASSERT_LE(position, blocks) << "iteration " << iteration;
+        ASSERT_LE(blocks - position, 3U) << "iteration " << iteration;
+        ASSERT_TRUE(referenceValid(text.substr(0U, position))) << "iteration " << iteration;
+        if (position < blocks) {
+            ASSERT_GE(uint8_t(text[position]), 0xC0U) << "iteration " << iteration;
+        }
+        else if (npos == referencePrefix(text.substr(0U, blocks))) {
+            FAIL() << "malformed input is accepted, iteration " << iteration;
+        }
+    }
+}
+
+} // namespace
+
+TEST(Utf8ValidatorTest, WellFormed) {
+    EXPECT_TRUE(Utf8Validator::isValid(""));
+    EXPECT_TRUE(Utf8Validator::isValid("{\"key\":\"value\"}"));
+    EXPECT_TRUE(Utf8Validator::isValid("\xC2\x80\xDF\xBF"));                 // U+0080, U+07FF
+    EXPECT_TRUE(Utf8Validator::isValid("\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80")); // U+0800, U+D7FF, U+E000
+    EXPECT_TRUE(Utf8Validator::isValid("\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"));     // U+10000, U+10FFFF
+    EXPECT_TRUE(Utf8Validator::isValid("Привет, 世界! 😀 and a long ASCII tail to cross the block size"));
+}
+
+TEST(Utf8ValidatorTest, Malformed) {
+    const char* cases[] = {
+        "\x80",             // stray continuation
+        "\xC0\xAF",         // overlong 2 bytes
+        "\xC1\xBF",         // overlong 2 bytes
+        "\xE0\x9F\xBF",     // overlong 3 bytes
+        "\xED\xA0\x80",     // surrogate
+        "\xF0\x8F\xBF\xBF", // overlong 4 bytes
+        "\xF4\x90\x80\x80", // above U+10FFFF
+        "\xF5\x80\x80\x80", // invalid lead
+        "\xFF",
+        "\xC2\x41",         // missing continuation
+        "\xE2\x82",         // truncated
+        "\xF0\x9F\x98"      // truncated
+    };
+    for (const auto text : cases) {
+        EXPECT_FALSE(Utf8Validator::isValid(text)) << text;
+        // at the start, in the middle and at the end of vector blocks
+        for (size_t pad : {15U, 31U, 40U, 63U}) {
+            EXPECT_FALSE(Utf8Validator::isValid(std::string(pad, 'a') + text + std::string(pad, 'b')))
+                << pad;
+        }
+    }
+}
+
+TEST(Utf8ValidatorTest, IncompleteUntilLastChunk) {
+    Utf8Validator validator;
+    EXPECT_TRUE(validator.validate(std::string(40U, 'a') + "\xF0\x9F"));
+    EXPECT_TRUE(validator.valid());
+    EXPECT_FALSE(validator.complete());
+    EXPECT_TRUE(validator.validate("\x98\x80"));
+    EXPECT_TRUE(validator.complete());
+    EXPECT_FALSE(validator.validate("\x80"));
+    EXPECT_FALSE(validator.validate("a"));
+    validator.reset();
+    EXPECT_TRUE(validator.validate("a"));
+    EXPECT_TRUE(validator.complete());
+}
+
+TEST(Utf8ValidatorTest, MatchesReference) {
+    std::mt19937 random(42U);
+    for (size_t iteration = 0U; iteration < 20000U; ++iteration) {
+        const auto text = randomText(random, random() % 300U, iteration % 4U);
+        const bool expected = referenceValid(text);
+        ASSERT_EQ(expected, Utf8Validator::isValid(text)) << "iteration " << iteration;
+        ASSERT_EQ(expected, validateChunked(text, 1U + iteration % 37U)) << "iteration " << iteration;
+    }
+}
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_SSSE3
+TEST(Utf8ValidatorTest, Ssse3KernelMatchesReference) {
+    if (!Utf8Details::hasSsse3()) {
+        GTEST_SKIP() << "SSSE3 is not supported by CPU";
+    }
+    expectKernelMatchesReference(&Utf8Details::validateSsse3, 16U);
+}
+#endif
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_AVX2
+TEST(Utf8ValidatorTest, Avx2KernelMatchesReference) {
+    if (!Utf8Details::hasAvx2()) {
+        GTEST_SKIP() << "AVX2 is not supported by CPU";
+    }
+    expectKernelMatchesReference(&Utf8Details::validateAvx2, 32U);
+}
+#endif
+
+#ifdef WEBSOCKET_UTF8_VALIDATOR_NEON
+TEST(Utf8ValidatorTest, NeonKernelMatchesReference) {
+    expectKernelMatchesReference(&Utf8Details::validateNeon, 16U);
+}
+#endif
+
+} // namespace Websocket
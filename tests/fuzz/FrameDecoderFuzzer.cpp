@@ -0,0 +1,119 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WebsocketFrameDecoder.h"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// input layout: [flags] [chunk size] [stream bytes...], where flags select
+// the side (bit 0), negotiated compression (bit 1) and the message size limit (bits 2-7)
+
+namespace {
+
+using namespace Websocket;
+
+void check(bool condition) {
+    if (!condition) {
+        std::abort();
+    }
+}
+
+// verifies invariants of decoder events and keeps the event log for comparison
+class CheckingListener : public FrameListener
+{
+public:
+    explicit CheckingListener(uint64_t maxMessageSize)
+        : _maxMessageSize(maxMessageSize)
+    {
+    }
+    const std::string& log() const noexcept { return _log; }
+    // impl. of FrameListener
+    void onMessageFragment(Opcode opcode, bool compressed, const uint8_t* data, size_t size,
+                           bool first, bool last) final {
+        check(!_finished);
+        check(Opcode::Text == opcode || Opcode::Binary == opcode);
+        check(first != _inMessage);
+        check(size == 0U || nullptr != data);
+        if (first) {
+            _message.clear();
+        }
+        _message.append(reinterpret_cast<const char*>(data), size);
+        check(0U == _maxMessageSize || _message.size() <= _maxMessageSize);
+        _inMessage = !last;
+        if (last) {
+            check(Opcode::Binary == opcode || compressed || Utf8Validator::isValid(_message));
+            // fragments depend on reads, so only complete messages are logged
+            _log += static_cast<char>(opcode);
+            _log += _message;
+        }
+    }
+    void onPing(const uint8_t* payload, size_t size) final { control('P', payload, size); }
+    void onPong(const uint8_t* payload, size_t size) final { control('O', payload, size); }
+    void onClose(uint16_t code, std::string_view reason) final {
+        check(!_finished);
+        check(reason.size() <= FrameCodec::MaxControlPayloadSize - 2U && Utf8Validator::isValid(reason));
+        _finished = true;
+        _log += "C" + std::to_string(code);
+    }
+    void onProtocolError(uint16_t closeCode, std::string_view details) final {
+        check(!_finished);
+        check(CloseCode::ProtocolError == closeCode || CloseCode::InvalidPayload == closeCode ||
+              CloseCode::MessageTooBig == closeCode);
+        check(!details.empty());
+        _finished = true;
+        _log += "E" + std::to_string(closeCode);
+    }
+
+private:
+    void control(char type, const uint8_t* payload, size_t size) {
+        check(!_finished);
+        check(size <= FrameCodec::MaxControlPayloadSize);
+        _log += type;
+        _log.append(reinterpret_cast<const char*>(payload), size);
+    }
+
+private:
+    const uint64_t _maxMessageSize;
+    std::string _log;
+    std::string _message;
+    bool _inMessage = false;
+    bool _finished = false;
+};
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (size < 2U) {
+        return 0;
+    }
+    const bool server = 0U != (data[0] & 1U);
+    const bool perMessageDeflate = 0U != (data[0] & 2U);
+    const uint64_t maxMessageSize = uint64_t(data[0] >> 2U) * 37U;
+    const size_t chunk = 1U + data[1];
+    const std::vector<uint8_t> stream(data + 2, data + size);
+    // decoding by chunks must match decoding at once
+    CheckingListener whole(maxMessageSize), chunked(maxMessageSize);
+    FrameDecoder wholeDecoder(whole, server, maxMessageSize, perMessageDeflate);
+    FrameDecoder chunkedDecoder(chunked, server, maxMessageSize, perMessageDeflate);
+    auto wholeBytes = stream, chunkedBytes = stream;
+    const bool ok = wholeDecoder.decode(wholeBytes.data(), wholeBytes.size());
+    bool chunkedOk = true;
+    for (size_t pos = 0U; pos < chunkedBytes.size(); pos += chunk) {
+        chunkedOk = chunkedDecoder.decode(chunkedBytes.data() + pos, std::min(chunk, chunkedBytes.size() - pos));
+    }
+    check(ok == chunkedOk && ok == !wholeDecoder.failed());
+    check(wholeDecoder.closed() == chunkedDecoder.closed());
+    check(whole.log() == chunked.log());
+    return 0;
+}
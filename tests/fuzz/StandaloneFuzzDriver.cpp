@@ -0,0 +1,118 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// replacement of libFuzzer main for compilers without -fsanitize=fuzzer: runs the corpus
+// files and [-runs=N] random mutations of them, accepts libFuzzer-compatible arguments
+// `[-runs=N] [-seed=N] [corpus directories or files...]`, other options are ignored
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace {
+
+using Input = std::vector<uint8_t>;
+
+uint64_t next(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+void load(const std::filesystem::path& path, std::vector<Input>& inputs) {
+    std::error_code error;
+    if (std::filesystem::is_directory(path, error)) {
+        for (const auto& entry : std::filesystem::directory_iterator(path, error)) {
+            load(entry.path(), inputs);
+        }
+    }
+    else if (std::filesystem::is_regular_file(path, error)) {
+        std::ifstream file(path, std::ios::binary);
+        inputs.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+}
+
+Input mutate(Input input, uint64_t& state) {
+    const auto mutations = 1U + next(state) % 4U;
+    for (uint64_t i = 0U; i < mutations; ++i) {
+        const auto pos = input.empty() ? 0U : static_cast<size_t>(next(state) % input.size());
+        switch (next(state) % 5U) {
+            case 0U: // flip a bit
+                if (!input.empty()) {
+                    input[pos] ^= static_cast<uint8_t>(1U << (next(state) % 8U));
+                }
+                break;
+            case 1U: // replace by a random byte
+                if (!input.empty()) {
+                    input[pos] = static_cast<uint8_t>(next(state));
+                }
+                break;
+            case 2U: // insert a random byte
+                input.insert(input.begin() + static_cast<std::ptrdiff_t>(pos), static_cast<uint8_t>(next(state)));
+                break;
+            case 3U: // truncate
+                input.resize(pos);
+                break;
+            default: // duplicate the tail
+                input.insert(input.end(), input.begin() + static_cast<std::ptrdiff_t>(pos), input.end());
+                break;
+        }
+    }
+    return input;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint64_t runs = 0U, state = 0x2545F4914F6CDD1DULL;
+    std::vector<Input> corpus;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (0U == arg.rfind("-runs=", 0U)) {
+            runs = std::strtoull(arg.c_str() + 6, nullptr, 10);
+        }
+        else if (0U == arg.rfind("-seed=", 0U)) {
+            state = std::strtoull(arg.c_str() + 6, nullptr, 10) | 1U;
+        }
+        else if ('-' != arg.front()) {
+            load(arg, corpus);
+        }
+    }
+    for (const auto& input : corpus) {
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+    for (uint64_t run = 0U; run < runs; ++run) {
+        Input input;
+        if (corpus.empty()) {
+            input.resize(next(state) % 256U);
+            for (auto& byte : input) {
+                byte = static_cast<uint8_t>(next(state));
+            }
+        }
+        else {
+            input = mutate(corpus[next(state) % corpus.size()], state);
+        }
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+    std::printf("Done %llu corpus inputs and %llu runs\n",
+                static_cast<unsigned long long>(corpus.size()), static_cast<unsigned long long>(runs));
+    return 0;
+}
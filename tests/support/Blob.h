@@ -0,0 +1,31 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // Blob.h
+#include <cstddef>
+#include <cstdint>
+
+// stand-in of the blob prototype from 'Bricks' library for tests and benchmarks,
+// see https://github.com/ArtiomKhachaturian/Bricks
+namespace Bricks
+{
+
+class Blob
+{
+public:
+    virtual ~Blob() = default;
+    virtual size_t size() const noexcept = 0;
+    virtual const uint8_t* data() const noexcept = 0;
+};
+
+} // namespace Bricks
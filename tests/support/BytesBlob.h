@@ -0,0 +1,40 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // BytesBlob.h
+#include "Blob.h"
+#include <string_view>
+#include <vector>
+
+namespace Websocket
+{
+
+// blob owning a copy of bytes, for tests and benchmarks
+class BytesBlob : public Bricks::Blob
+{
+public:
+    BytesBlob() = default;
+    BytesBlob(const uint8_t* data, size_t size) : _bytes(data, data + size) {}
+    explicit BytesBlob(std::string_view text)
+        : BytesBlob(reinterpret_cast<const uint8_t*>(text.data()), text.size()) {}
+    explicit BytesBlob(std::vector<uint8_t> bytes) : _bytes(std::move(bytes)) {}
+    const std::vector<uint8_t>& bytes() const noexcept { return _bytes; }
+    // impl. of Bricks::Blob
+    size_t size() const noexcept final { return _bytes.size(); }
+    const uint8_t* data() const noexcept final { return _bytes.data(); }
+
+private:
+    std::vector<uint8_t> _bytes;
+};
+
+} // namespace Websocket
@@ -0,0 +1,73 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // FrameRecorder.h
+#include "WebsocketFrameDecoder.h"
+#include <string>
+#include <vector>
+
+namespace Websocket
+{
+
+// appends the frame with payload to [out], masked if [key] is not null
+inline void appendTestFrame(std::vector<uint8_t>& out, Opcode opcode, std::string_view payload,
+                            bool fin = true, const FrameCodec::MaskKey* key = nullptr, bool rsv1 = false) {
+    uint8_t header[FrameCodec::MaxHeaderSize];
+    const auto headerSize = FrameCodec::writeHeader(header, opcode, fin, payload.size(), key, rsv1);
+    out.insert(out.end(), header, header + headerSize);
+    const auto offset = out.size();
+    out.insert(out.end(), payload.begin(), payload.end());
+    if (key) {
+        FrameCodec::mask(out.data() + offset, payload.size(), *key);
+    }
+}
+
+// records decoder events as text lines, e.g. "text+:abc" for the first part of a text message,
+// "-" suffix of the opcode marks the final part
+class FrameRecorder : public FrameListener
+{
+public:
+    std::vector<std::string> _events;
+    std::string _message;
+    std::vector<std::string> _messages;
+    uint16_t _errorCode = 0U;
+    // impl. of FrameListener
+    void onMessageFragment(Opcode opcode, bool compressed, const uint8_t* data, size_t size,
+                           bool first, bool last) override {
+        const std::string payload(reinterpret_cast<const char*>(data), size);
+        _events.push_back(std::string(Opcode::Text == opcode ? "text" : "binary") + (compressed ? "z" : "") +
+                          (first ? "+" : "") + (last ? "-" : "") + ":" + payload);
+        if (first) {
+            _message.clear();
+        }
+        _message += payload;
+        if (last) {
+            _messages.push_back(_message);
+        }
+    }
+    void onPing(const uint8_t* payload, size_t size) override {
+        _events.push_back("ping:" + std::string(reinterpret_cast<const char*>(payload), size));
+    }
+    void onPong(const uint8_t* payload, size_t size) override {
+        _events.push_back("pong:" + std::string(reinterpret_cast<const char*>(payload), size));
+    }
+    void onClose(uint16_t code, std::string_view reason) override {
+        _events.push_back("close:" + std::to_string(code) + ":" + std::string(reason));
+    }
+    void onProtocolError(uint16_t closeCode, std::string_view) override {
+        _errorCode = closeCode;
+        _events.push_back("error:" + std::to_string(closeCode));
+    }
+};
+
+} // namespace Websocket
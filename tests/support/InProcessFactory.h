@@ -0,0 +1,299 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // InProcessFactory.h
+#include "BytesBlob.h"
+#include "WebsocketAcceptor.h"
+#include "WebsocketCloseCode.h"
+#include "WebsocketEndPoint.h"
+#include "WebsocketError.h"
+#include "WebsocketFactory.h"
+#include "WebsocketListener.h"
+#include "WebsocketState.h"
+#include "WebsocketUtf8Validator.h"
+#include <atomic>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+
+namespace Websocket
+{
+
+// category of `Error::_code` reporting the close code of the peer, e.g. `CloseCode::GoingAway`
+inline const std::error_category& inProcessCloseCategory() noexcept {
+    class Category : public std::error_category
+    {
+    public:
+        const char* name() const noexcept final { return "websocket close code"; }
+        std::string message(int code) const final { return "closed by peer with code " + std::to_string(code); }
+    };
+    static const Category category;
+    return category;
+}
+
+// registry of in-process acceptors of a single factory, by name
+class InProcessHub
+{
+public:
+    bool bind(std::string_view name, std::shared_ptr<AcceptorListener> listener) {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        return !name.empty() && _acceptors.emplace(std::string(name), std::move(listener)).second;
+    }
+    void unbind(std::string_view name) {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _acceptors.erase(std::string(name));
+    }
+    std::shared_ptr<AcceptorListener> find(std::string_view name) const {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _acceptors.find(std::string(name));
+        return _acceptors.end() == it ? nullptr : it->second;
+    }
+    uint64_t nextConnectionId() noexcept { return ++_connections; }
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, std::shared_ptr<AcceptorListener>> _acceptors;
+    std::atomic<uint64_t> _connections = 0U;
+};
+
+// `Scheme::InProcess` endpoint: messages are delivered synchronously on the thread
+// of the sender, shared blobs are passed to the peer listener by reference,
+// pings are answered by the peer immediately, options other than `_host` are ignored;
+// text must be valid UTF-8, close codes other than `CloseCode::Normal` are reported
+// to the peer listener by `onError` (see `inProcessCloseCategory`) before disconnection
+class InProcessEndPoint : public EndPoint
+{
+    // state of one side of the connection, outlives the endpoint while delivery is in progress
+    struct Side
+    {
+        std::mutex _mutex;
+        std::shared_ptr<Listener> _listener;
+        std::weak_ptr<Side> _peer;
+        std::string _host;
+        State _state = State::Disconnected;
+        uint64_t _socketId = 0U;
+        uint64_t _connectionId = 0U;
+        bool _accepted = false;
+    };
+
+public:
+    explicit InProcessEndPoint(std::shared_ptr<InProcessHub> hub) : _hub(std::move(hub)) {
+        _side->_socketId = id();
+    }
+    // the peer sees the connection going away, as if the process of the endpoint exited
+    ~InProcessEndPoint() override { close(CloseCode::GoingAway); }
+    // impl. of EndPoint
+    void setListener(const std::shared_ptr<Listener>& listener) final {
+        const std::lock_guard<std::mutex> lock(_side->_mutex);
+        _side->_listener = listener;
+    }
+    bool open(Options options, uint64_t connectionId = 0U) final;
+    void close() final { close(CloseCode::Normal); }
+    // closes the connection with the code & reason sent to the peer
+    void close(uint16_t code, std::string_view reason = {});
+    std::string host() const final {
+        const std::lock_guard<std::mutex> lock(_side->_mutex);
+        return _side->_host;
+    }
+    State state() const final {
+        const std::lock_guard<std::mutex> lock(_side->_mutex);
+        return _side->_state;
+    }
+    bool sendBinary(const Bricks::Blob& binary) final {
+        return sendSharedBinary(std::make_shared<const BytesBlob>(binary.data(), binary.size()));
+    }
+    bool sendText(std::string_view text) final {
+        // the peer listener relies on valid UTF-8, see `Listener::onTextMessage`
+        return Utf8Validator::isValid(text) && deliver(peer(), [text](Listener& listener, uint64_t socketId, uint64_t connectionId) {
+            listener.onTextMessage(socketId, connectionId, text);
+        });
+    }
+    bool sendSharedBinary(std::shared_ptr<const Bricks::Blob> binary) final {
+        return binary && deliver(peer(), [&binary](Listener& listener, uint64_t socketId, uint64_t connectionId) {
+            listener.onSharedBinaryMessage(socketId, connectionId, std::move(binary));
+        });
+    }
+    bool ping(const Bricks::Blob& payload) final {
+        // the peer answers with the same payload, without involving its listener
+        return peer() && deliver(_side, [&payload](Listener& listener, uint64_t socketId, uint64_t connectionId) {
+            listener.onPong(socketId, connectionId, payload);
+        });
+    }
+    bool ping() final { return ping(BytesBlob()); }
+
+private:
+    friend class InProcessAcceptor;
+    std::shared_ptr<Side> peer() const {
+        const std::lock_guard<std::mutex> lock(_side->_mutex);
+        return State::Connected == _side->_state ? _side->_peer.lock() : nullptr;
+    }
+    // calls the listener of [side] outside of its lock, `false` if [side] is null
+    template <class Callback>
+    static bool deliver(const std::shared_ptr<Side>& side, const Callback& callback) {
+        if (side) {
+            std::unique_lock<std::mutex> lock(side->_mutex);
+            const auto listener = side->_listener;
+            const auto socketId = side->_socketId, connectionId = side->_connectionId;
+            lock.unlock();
+            if (listener) {
+                callback(*listener, socketId, connectionId);
+            }
+            return true;
+        }
+        return false;
+    }
+    static void setState(const std::shared_ptr<Side>& side, State state) {
+        {
+            const std::lock_guard<std::mutex> lock(side->_mutex);
+            if (state == side->_state) {
+                return;
+            }
+            side->_state = state;
+        }
+        deliver(side, [state](Listener& listener, uint64_t socketId, uint64_t connectionId) {
+            listener.onStateChanged(socketId, connectionId, state);
+        });
+    }
+
+private:
+    const std::shared_ptr<InProcessHub> _hub;
+    const std::shared_ptr<Side> _side = std::make_shared<Side>();
+};
+
+// `Scheme::InProcess` acceptor, `AcceptorOptions::_address` is `inproc://name`
+class InProcessAcceptor : public Acceptor
+{
+public:
+    explicit InProcessAcceptor(std::shared_ptr<InProcessHub> hub) : _hub(std::move(hub)) {}
+    ~InProcessAcceptor() override { stop(); }
+    // links [client] with a new accepted endpoint, `false` if the connection is rejected
+    static bool accept(const std::shared_ptr<InProcessHub>& hub, const std::shared_ptr<InProcessEndPoint::Side>& client,
+                       std::string_view name, std::string_view resource);
+    // impl. of Acceptor
+    bool start(AcceptorOptions options, const std::shared_ptr<AcceptorListener>& listener) final {
+        const auto name = inProcessName(options._address);
+        if (listener && _name.empty() && _hub->bind(name, listener)) {
+            _name = std::string(name);
+            return true;
+        }
+        return false;
+    }
+    void stop() final {
+        if (!_name.empty()) {
+            _hub->unbind(_name);
+            _name.clear();
+        }
+    }
+    uint16_t port() const final { return 0U; }
+
+private:
+    const std::shared_ptr<InProcessHub> _hub;
+    std::string _name;
+};
+
+// reference implementation of `Scheme::InProcess` for tests and benchmarks,
+// endpoints connect to acceptors of the same factory only
+class InProcessFactory : public Factory
+{
+public:
+    // impl. of Factory
+    std::unique_ptr<EndPoint> create() const final { return std::make_unique<InProcessEndPoint>(_hub); }
+    std::unique_ptr<Acceptor> createAcceptor() const final { return std::make_unique<InProcessAcceptor>(_hub); }
+    bool supportsScheme(Scheme scheme) const final { return Scheme::InProcess == scheme; }
+
+private:
+    const std::shared_ptr<InProcessHub> _hub = std::make_shared<InProcessHub>();
+};
+
+inline bool InProcessEndPoint::open(Options options, uint64_t connectionId) {
+    {
+        const std::lock_guard<std::mutex> lock(_side->_mutex);
+        if (_side->_accepted || State::Disconnected != _side->_state ||
+            Scheme::InProcess != schemeOf(options._host)) {
+            return false;
+        }
+        _side->_host = std::move(options._host);
+        _side->_connectionId = connectionId;
+    }
+    setState(_side, State::Connecting);
+    const auto& url = _side->_host;
+    if (!InProcessAcceptor::accept(_hub, _side, inProcessName(url), inProcessResource(url))) {
+        deliver(_side, [&url](Listener& listener, uint64_t socketId, uint64_t connection) {
+            listener.onError(socketId, connection, {Failure::NoConnection, {}, "no in-process acceptor for " + url});
+        });
+        setState(_side, State::Disconnected);
+        return false;
+    }
+    {
+        // the accepted endpoint may be dropped (and closed) by the acceptor listener
+        const std::lock_guard<std::mutex> lock(_side->_mutex);
+        if (State::Connecting != _side->_state || _side->_peer.expired()) {
+            return false;
+        }
+    }
+    setState(_side, State::Connected);
+    return true;
+}
+
+inline void InProcessEndPoint::close(uint16_t code, std::string_view reason) {
+    std::shared_ptr<Side> peer;
+    {
+        const std::lock_guard<std::mutex> lock(_side->_mutex);
+        if (State::Connected != _side->_state) {
+            return;
+        }
+        peer = _side->_peer.lock();
+        _side->_peer.reset();
+    }
+    setState(_side, State::Disconnecting);
+    if (peer) {
+        {
+            const std::lock_guard<std::mutex> lock(peer->_mutex);
+            peer->_peer.reset();
+        }
+        if (CloseCode::Normal != code) {
+            deliver(peer, [code, reason](Listener& listener, uint64_t socketId, uint64_t connectionId) {
+                const std::error_code error(code, inProcessCloseCategory());
+                listener.onError(socketId, connectionId, {Failure::General, error, std::string(reason)});
+            });
+        }
+        setState(peer, State::Disconnected);
+    }
+    setState(_side, State::Disconnected);
+}
+
+inline bool InProcessAcceptor::accept(const std::shared_ptr<InProcessHub>& hub,
+                                      const std::shared_ptr<InProcessEndPoint::Side>& client,
+                                      std::string_view name, std::string_view resource) {
+    const auto listener = hub->find(name);
+    if (!listener || !listener->onUpgradeRequest(resource, {})) {
+        return false;
+    }
+    auto accepted = std::make_unique<InProcessEndPoint>(hub);
+    const auto connectionId = hub->nextConnectionId();
+    {
+        const std::lock_guard<std::mutex> lock(accepted->_side->_mutex);
+        accepted->_side->_accepted = true;
+        accepted->_side->_connectionId = connectionId;
+        accepted->_side->_state = State::Connected;
+        accepted->_side->_peer = client;
+    }
+    {
+        const std::lock_guard<std::mutex> lock(client->_mutex);
+        client->_peer = accepted->_side;
+    }
+    listener->onAccepted(std::move(accepted), connectionId);
+    return true;
+}
+
+} // namespace Websocket